@@ -0,0 +1,138 @@
+#include "adjoint.hpp"
+
+namespace hephaestus
+{
+
+LinearObjective::LinearObjective(std::string var_name, std::string weight_coef_name)
+  : _var_name(std::move(var_name)), _weight_coef_name(std::move(weight_coef_name))
+{
+}
+
+void
+LinearObjective::Init(const hephaestus::GridFunctions & gridfunctions,
+                      hephaestus::Coefficients & coefficients)
+{
+  _gf = gridfunctions.Get(_var_name);
+
+  _weights = std::make_unique<mfem::ParLinearForm>(_gf->ParFESpace());
+  _weights->AddDomainIntegrator(
+      new mfem::VectorFEDomainLFIntegrator(*coefficients._vectors.Get(_weight_coef_name)));
+  _weights->Assemble();
+}
+
+double
+LinearObjective::Evaluate() const
+{
+  return (*_weights)(*_gf);
+}
+
+void
+LinearObjective::AddGradient(const std::string & var_name, mfem::Vector & gradient) const
+{
+  if (var_name == _var_name)
+  {
+    gradient += *_weights;
+  }
+}
+
+EnergyObjective::EnergyObjective(std::vector<std::string> var_names,
+                                 std::string coef_name,
+                                 bool curl)
+  : _var_names(std::move(var_names)), _coef_name(std::move(coef_name)), _curl(curl)
+{
+}
+
+void
+EnergyObjective::Init(const hephaestus::GridFunctions & gridfunctions,
+                      hephaestus::Coefficients & coefficients)
+{
+  mfem::Coefficient * coef = coefficients._scalars.Get(_coef_name);
+
+  _gfs = gridfunctions.Get(_var_names);
+  _blfs.clear();
+  for (auto * gf : _gfs)
+  {
+    auto blf = std::make_unique<mfem::ParBilinearForm>(gf->ParFESpace());
+    if (_curl)
+    {
+      blf->AddDomainIntegrator(new mfem::CurlCurlIntegrator(*coef));
+    }
+    else
+    {
+      blf->AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*coef));
+    }
+    blf->Assemble();
+    blf->Finalize();
+    _blfs.push_back(std::move(blf));
+  }
+}
+
+double
+EnergyObjective::Evaluate() const
+{
+  double objective = 0.0;
+  for (size_t i = 0; i < _gfs.size(); ++i)
+  {
+    objective += 0.5 * _blfs[i]->ParInnerProduct(*_gfs[i], *_gfs[i]);
+  }
+
+  return objective;
+}
+
+void
+EnergyObjective::AddGradient(const std::string & var_name, mfem::Vector & gradient) const
+{
+  for (size_t i = 0; i < _gfs.size(); ++i)
+  {
+    if (_var_names[i] == var_name)
+    {
+      _blfs[i]->AddMult(*_gfs[i], gradient);
+    }
+  }
+}
+
+void
+AddSubdomainProducts(mfem::BilinearFormIntegrator & integrator,
+                     const mfem::ParGridFunction & lambda,
+                     const mfem::ParGridFunction & u,
+                     double scale,
+                     const std::vector<hephaestus::Subdomain> & subdomains,
+                     std::map<std::string, double> & products)
+{
+  mfem::ParFiniteElementSpace * fespace = u.ParFESpace();
+  mfem::ParMesh * pmesh = fespace->GetParMesh();
+
+  // Accumulate λ_eᵀ K_e u_e by element attribute.
+  mfem::Vector attribute_products(pmesh->attributes.Max());
+  attribute_products = 0.0;
+
+  // Element DOF values are taken in the reference basis of the element matrix.
+  mfem::Vector lambda_e, u_e;
+  mfem::DenseMatrix elmat;
+  for (int e = 0; e < pmesh->GetNE(); ++e)
+  {
+    integrator.AssembleElementMatrix(
+        *fespace->GetFE(e), *pmesh->GetElementTransformation(e), elmat);
+
+    lambda.GetElementDofValues(e, lambda_e);
+    u.GetElementDofValues(e, u_e);
+    attribute_products(pmesh->GetAttribute(e) - 1) += elmat.InnerProduct(u_e, lambda_e);
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE,
+                attribute_products.GetData(),
+                attribute_products.Size(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                pmesh->GetComm());
+
+  for (const auto & subdomain : subdomains)
+  {
+    if (subdomain._id >= 1 && subdomain._id <= attribute_products.Size())
+    {
+      products[subdomain._name] += scale * attribute_products(subdomain._id - 1);
+    }
+  }
+}
+
+} // namespace hephaestus
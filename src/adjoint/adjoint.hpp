@@ -0,0 +1,106 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "coefficients.hpp"
+#include "gridfunctions.hpp"
+
+#include <map>
+
+namespace hephaestus
+{
+
+/// Sensitivities of a scalar objective J computed by an adjoint solve.
+struct AdjointSensitivities
+{
+  double _objective{0.0};
+
+  // dJ/dc for a uniform additive change of the scalar coefficient c on each subdomain, keyed by
+  // coefficient name and then by subdomain name.
+  std::map<std::string, std::map<std::string, double>> _coefficients;
+
+  // dJ/ds for a scaling s of each source about s = 1, keyed by source name. For a source with
+  // amplitude I, dJ/dI = (dJ/ds) / I.
+  std::map<std::string, double> _sources;
+};
+
+/// Scalar objective J(u) of the solution, used to drive an adjoint solve. Derive from this class to
+/// define further objectives, such as forces from the Maxwell stress.
+class AdjointObjective
+{
+public:
+  AdjointObjective() = default;
+  virtual ~AdjointObjective() = default;
+
+  virtual void Init(const hephaestus::GridFunctions & gridfunctions,
+                    hephaestus::Coefficients & coefficients) = 0;
+
+  /// Returns the value of the objective for the current gridfunctions.
+  [[nodiscard]] virtual double Evaluate() const = 0;
+
+  /// Adds dJ/du for the gridfunction @a var_name to @a gradient, a dual (linear form) vector on its
+  /// FE space. Adds nothing if the objective does not depend on the gridfunction.
+  virtual void AddGradient(const std::string & var_name, mfem::Vector & gradient) const = 0;
+};
+
+/// Linear objective J = ∫ w⋅u dΩ of an H(curl) gridfunction u. With u the magnetic vector
+/// potential and w the winding density of a coil, J is the flux linked by the coil.
+class LinearObjective : public AdjointObjective
+{
+public:
+  LinearObjective(std::string var_name, std::string weight_coef_name);
+
+  ~LinearObjective() override = default;
+
+  void Init(const hephaestus::GridFunctions & gridfunctions,
+            hephaestus::Coefficients & coefficients) override;
+
+  [[nodiscard]] double Evaluate() const override;
+
+  void AddGradient(const std::string & var_name, mfem::Vector & gradient) const override;
+
+private:
+  const std::string _var_name;
+  const std::string _weight_coef_name;
+
+  mfem::ParGridFunction * _gf{nullptr};
+  std::unique_ptr<mfem::ParLinearForm> _weights{nullptr};
+};
+
+/// Quadratic objective J = ½ Σ ∫ c |Du|² dΩ summed over H(curl) gridfunctions u, where D is the
+/// curl or the identity. With D the curl and c the reluctivity, J is the magnetic energy; with D
+/// the identity, c the conductivity and u the real and imaginary parts of a phasor electric field,
+/// J is the time-averaged ohmic loss.
+class EnergyObjective : public AdjointObjective
+{
+public:
+  EnergyObjective(std::vector<std::string> var_names, std::string coef_name, bool curl);
+
+  ~EnergyObjective() override = default;
+
+  void Init(const hephaestus::GridFunctions & gridfunctions,
+            hephaestus::Coefficients & coefficients) override;
+
+  [[nodiscard]] double Evaluate() const override;
+
+  void AddGradient(const std::string & var_name, mfem::Vector & gradient) const override;
+
+private:
+  const std::vector<std::string> _var_names;
+  const std::string _coef_name;
+  const bool _curl;
+
+  std::vector<mfem::ParGridFunction *> _gfs;
+  std::vector<std::unique_ptr<mfem::ParBilinearForm>> _blfs;
+};
+
+/// Adds scale * λᵀ K u to the entry of each subdomain in @a products, where K is the matrix of
+/// @a integrator assembled over the elements of the subdomain. This is the derivative of λᵀ A u for
+/// a uniform additive change of a coefficient of A on each subdomain, for all subdomains in a
+/// single pass over the mesh.
+void AddSubdomainProducts(mfem::BilinearFormIntegrator & integrator,
+                          const mfem::ParGridFunction & lambda,
+                          const mfem::ParGridFunction & u,
+                          double scale,
+                          const std::vector<hephaestus::Subdomain> & subdomains,
+                          std::map<std::string, double> & products);
+
+} // namespace hephaestus
@@ -60,8 +60,13 @@ calcFlux(mfem::GridFunction * v_field, int face_attr, mfem::Coefficient & q)
     }
   }
 
-  double total_flux;
-  MPI_Allreduce(&flux, &total_flux, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  // Sum over the ranks sharing the mesh; serial spaces need no reduction.
+  double total_flux = flux;
+  auto * pfes = dynamic_cast<mfem::ParFiniteElementSpace *>(fes);
+  if (pfes != nullptr)
+  {
+    MPI_Allreduce(&flux, &total_flux, 1, MPI_DOUBLE, MPI_SUM, pfes->GetComm());
+  }
 
   return total_flux;
 }
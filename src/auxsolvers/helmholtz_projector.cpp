@@ -8,6 +8,11 @@ HelmholtzProjector::HelmholtzProjector(const hephaestus::InputParameters & param
     _hcurl_fespace_name(params.GetOptionalParam<std::string>("HCurlFESpaceName", "HCurlFES_Name")),
     _gf_grad_name(params.GetParam<std::string>("VectorGridFunctionName")),
     _gf_name(params.GetOptionalParam<std::string>("ScalarGridFunctionName", "ScalarGF_Name")),
+    _solver_params(hephaestus::LinearSolverParams::Parse(
+        params.GetOptionalParam<hephaestus::InputParameters>("SolverOptions", {}))),
+    _static_condensation(
+        params.GetOptionalParam<hephaestus::InputParameters>("SolverOptions", {})
+            .GetOptionalParam<bool>("StaticCondensation", false)),
 
     _g(nullptr),
 
@@ -16,15 +21,6 @@ HelmholtzProjector::HelmholtzProjector(const hephaestus::InputParameters & param
     _grad(nullptr),
     _a0(nullptr)
 {
-
-  hephaestus::InputParameters default_pars;
-  default_pars.SetParam("Tolerance", float(1.0e-20));
-  default_pars.SetParam("AbsTolerance", float(1.0e-20));
-  default_pars.SetParam("MaxIter", (unsigned int)1000);
-  default_pars.SetParam("PrintLevel", GetGlobalPrintLevel());
-
-  _solver_options =
-      params.GetOptionalParam<hephaestus::InputParameters>("SolverOptions", default_pars);
 }
 
 void
@@ -103,8 +99,15 @@ HelmholtzProjector::Project(hephaestus::GridFunctions & gridfunctions,
 void
 HelmholtzProjector::SetForms()
 {
-  if (_g_div == nullptr)
+  // <P(g).n, q>
+  if (_g_div == nullptr || _g_div->ParFESpace() != _h1_fe_space.get() ||
+      _g_div_bc_map != _bc_map || _g_div_bc_revision != _bc_map->GetRevision())
+  {
     _g_div = std::make_unique<mfem::ParLinearForm>(_h1_fe_space.get());
+    _bc_map->ApplyIntegratedBCs(_gf_name, *_g_div, (_h1_fe_space->GetParMesh()));
+    _g_div_bc_map = _bc_map;
+    _g_div_bc_revision = _bc_map->GetRevision();
+  }
 
   if (_weak_div == nullptr)
   {
@@ -118,6 +121,12 @@ HelmholtzProjector::SetForms()
   {
     _a0 = std::make_unique<mfem::ParBilinearForm>(_h1_fe_space.get());
     _a0->AddDomainIntegrator(new mfem::DiffusionIntegrator);
+    if (_static_condensation)
+    {
+      // The form is only used to solve for the potential, whose interior DOFs are recovered in
+      // RecoverFEMSolution.
+      _a0->EnableStaticCondensation();
+    }
     _a0->Assemble();
     _a0->Finalize();
   }
@@ -142,15 +151,14 @@ HelmholtzProjector::SetBCs()
   // (g, ∇q) - (∇Q, ∇q) - <P(g).n, q> = 0
   int myid = _h1_fe_space->GetMyRank();
 
-  // <P(g).n, q>
+  // The integrated BCs, <P(g).n, q>, are held by _g_div from SetForms.
   _bc_map->ApplyEssentialBCs(_gf_name, _ess_bdr_tdofs, *_q, (_h1_fe_space->GetParMesh()));
-  _bc_map->ApplyIntegratedBCs(_gf_name, *_g_div, (_h1_fe_space->GetParMesh()));
 
   // Apply essential BC. Necessary to ensure potential at least one point is
   // fixed.
   int localsize = _ess_bdr_tdofs.Size();
   int fullsize;
-  MPI_Allreduce(&fullsize, &localsize, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  MPI_Allreduce(&localsize, &fullsize, 1, MPI_INT, MPI_SUM, _h1_fe_space->GetComm());
 
   if (fullsize == 0 && myid == 0)
   {
@@ -176,7 +184,7 @@ HelmholtzProjector::SolveLinearSystem()
   mfem::Vector b0;
   _a0->FormLinearSystem(_ess_bdr_tdofs, *_q, *_g_div, a0, x0, b0);
 
-  hephaestus::DefaultGMRESSolver a0_solver(_solver_options, a0);
+  hephaestus::DefaultGMRESSolver a0_solver(_solver_params, a0);
 
   a0_solver.Mult(b0, x0);
   _a0->RecoverFEMSolution(x0, *_g_div, *_q);
@@ -23,7 +23,9 @@ private:
   std::string _h1_fespace_name;
   std::string _gf_grad_name;
   std::string _gf_name;
-  hephaestus::InputParameters _solver_options;
+  hephaestus::LinearSolverParams _solver_params;
+  // Whether the interior DOFs of the H1 potential are condensed from the projection system.
+  bool _static_condensation;
 
   std::shared_ptr<mfem::ParFiniteElementSpace> _h1_fe_space{nullptr};
   mfem::ParFiniteElementSpace * _h_curl_fe_space{nullptr};
@@ -36,6 +38,10 @@ private:
   mfem::ParGridFunction * _div_free_src_gf{nullptr};
 
   std::unique_ptr<mfem::ParLinearForm> _g_div;
+  // BC map and revision whose integrated BCs were added to _g_div. The BCs are added once, and
+  // again to a new form only if they change, as each application adds integrators to the form.
+  hephaestus::BCMap * _g_div_bc_map{nullptr};
+  std::size_t _g_div_bc_revision{0};
   std::unique_ptr<mfem::ParBilinearForm> _a0;
   std::unique_ptr<mfem::ParMixedBilinearForm> _weak_div;
   std::unique_ptr<mfem::ParDiscreteLinearOperator> _grad;
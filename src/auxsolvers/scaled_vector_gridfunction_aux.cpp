@@ -74,9 +74,12 @@ ScaledVectorGridFunctionAux::BuildMixedBilinearForm()
 void
 ScaledVectorGridFunctionAux::Solve(double t)
 {
-  mfem::Vector b(_test_fes->GetTrueVSize());  // Linear form true DOFs
-  mfem::Vector x(_test_fes->GetTrueVSize());  // H(Div) gridfunction true DOFs
-  mfem::Vector p(_trial_fes->GetTrueVSize()); // H(Curl) gridfunction true DOFs
+  mfem::Vector & b = _b; // Linear form true DOFs
+  mfem::Vector & x = _x; // H(Div) gridfunction true DOFs
+  mfem::Vector & p = _p; // H(Curl) gridfunction true DOFs
+  b.SetSize(_test_fes->GetTrueVSize());
+  x.SetSize(_test_fes->GetTrueVSize());
+  p.SetSize(_trial_fes->GetTrueVSize());
   b = 0.0;
   _input_gf->GetTrueDofs(p);
 
@@ -62,6 +62,9 @@ private:
   std::unique_ptr<mfem::HypreParMatrix> _a_mat{nullptr};
   std::unique_ptr<mfem::HypreParMatrix> _mixed_mat{nullptr};
 
+  // True DOF vectors, kept between solves to avoid reallocation
+  mfem::Vector _b, _x, _p;
+
   // Solver
   std::unique_ptr<hephaestus::DefaultJacobiPCGSolver> _solver{nullptr};
 };
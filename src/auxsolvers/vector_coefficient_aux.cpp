@@ -62,8 +62,9 @@ VectorCoefficientAux::BuildLinearForm()
 void
 VectorCoefficientAux::Solve(double t)
 {
-  mfem::Vector x(_test_fes->GetTrueVSize()); // Gridfunction true DOFs
-  _gf->ProjectCoefficient(*_vec_coef);       // Initial condition
+  mfem::Vector & x = _x; // Gridfunction true DOFs
+  x.SetSize(_test_fes->GetTrueVSize());
+  _gf->ProjectCoefficient(*_vec_coef); // Initial condition
   _gf->GetTrueDofs(x);
 
   // Reassemble in case coef has changed
@@ -35,6 +35,9 @@ protected:
   std::unique_ptr<mfem::ParBilinearForm> _a{nullptr};
   std::unique_ptr<mfem::ParLinearForm> _b{nullptr};
 
+  // True DOFs of the gridfunction, kept between solves to avoid reallocation.
+  mfem::Vector _x;
+
 private:
   const hephaestus::InputParameters _solver_options;
 
@@ -11,6 +11,10 @@ public:
 
   virtual void ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_) {}
   virtual void ApplyBC(mfem::ParComplexGridFunction & gridfunc, mfem::Mesh * mesh_) {}
+
+  /// Returns false if the boundary values are fixed in time, so that they need only be projected
+  /// once.
+  [[nodiscard]] virtual bool IsTimeDependent() const { return true; }
 };
 
 } // namespace hephaestus
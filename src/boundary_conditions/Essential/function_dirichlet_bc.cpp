@@ -19,9 +19,14 @@ ScalarDirichletBC::ScalarDirichletBC(const std::string & name_,
 void
 ScalarDirichletBC::ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_)
 {
-  mfem::Array<int> ess_bdrs(mesh_->bdr_attributes.Max());
-  ess_bdrs = GetMarkers(*mesh_);
-  gridfunc.ProjectBdrCoefficient(*(_coeff), ess_bdrs);
+  gridfunc.ProjectBdrCoefficient(*(_coeff), GetCachedMarkers(*mesh_));
+}
+
+bool
+ScalarDirichletBC::IsTimeDependent() const
+{
+  return !dynamic_cast<mfem::ConstantCoefficient *>(_coeff) ||
+         (_coeff_im && !dynamic_cast<mfem::ConstantCoefficient *>(_coeff_im));
 }
 
 } // namespace hephaestus
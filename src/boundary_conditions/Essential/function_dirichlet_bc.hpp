@@ -15,6 +15,9 @@ public:
 
   void ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_) override;
 
+  // Constant coefficients are treated as fixed in time.
+  [[nodiscard]] bool IsTimeDependent() const override;
+
   mfem::Coefficient * _coeff{nullptr};
   mfem::Coefficient * _coeff_im{nullptr};
 };
@@ -23,8 +23,7 @@ VectorDirichletBC::VectorDirichletBC(const std::string & name_,
 void
 VectorDirichletBC::ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_)
 {
-  mfem::Array<int> ess_bdrs(mesh_->bdr_attributes.Max());
-  ess_bdrs = GetMarkers(*mesh_);
+  mfem::Array<int> & ess_bdrs = GetCachedMarkers(*mesh_);
   if (_vec_coeff == nullptr)
   {
     MFEM_ABORT("Boundary condition does not store valid coefficients to specify the "
@@ -47,8 +46,7 @@ VectorDirichletBC::ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_)
 void
 VectorDirichletBC::ApplyBC(mfem::ParComplexGridFunction & gridfunc, mfem::Mesh * mesh_)
 {
-  mfem::Array<int> ess_bdrs(mesh_->bdr_attributes.Max());
-  ess_bdrs = GetMarkers(*mesh_);
+  mfem::Array<int> & ess_bdrs = GetCachedMarkers(*mesh_);
   if (_vec_coeff == nullptr || _vec_coeff_im == nullptr)
   {
     MFEM_ABORT("Boundary condition does not store valid coefficients to specify both "
@@ -58,4 +56,11 @@ VectorDirichletBC::ApplyBC(mfem::ParComplexGridFunction & gridfunc, mfem::Mesh *
   gridfunc.ProjectBdrCoefficientTangent(*(_vec_coeff), *(_vec_coeff_im), ess_bdrs);
 }
 
+bool
+VectorDirichletBC::IsTimeDependent() const
+{
+  return !dynamic_cast<mfem::VectorConstantCoefficient *>(_vec_coeff) ||
+         (_vec_coeff_im && !dynamic_cast<mfem::VectorConstantCoefficient *>(_vec_coeff_im));
+}
+
 } // namespace hephaestus
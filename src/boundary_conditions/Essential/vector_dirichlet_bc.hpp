@@ -27,6 +27,9 @@ public:
 
   void ApplyBC(mfem::ParComplexGridFunction & gridfunc, mfem::Mesh * mesh_) override;
 
+  // Constant coefficients are treated as fixed in time.
+  [[nodiscard]] bool IsTimeDependent() const override;
+
   mfem::VectorCoefficient * _vec_coeff{nullptr};
   mfem::VectorCoefficient * _vec_coeff_im{nullptr};
   APPLY_TYPE _boundary_apply_type;
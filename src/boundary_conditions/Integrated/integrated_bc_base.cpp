@@ -21,20 +21,27 @@ IntegratedBC::IntegratedBC(const std::string & name_,
 void
 IntegratedBC::ApplyBC(mfem::LinearForm & b)
 {
-  // NB: release ownership to prevent double-free. LinearForm assumes ownership.
-  b.AddBoundaryIntegrator(_lfi_re.release(), _markers);
+  // LinearForm assumes ownership of the adaptor, not of the BC's integrator.
+  if (_lfi_re)
+  {
+    b.AddBoundaryIntegrator(SharedLinearFormIntegrator::Share(_lfi_re), _markers);
+  }
 }
 
 void
 IntegratedBC::ApplyBC(mfem::ComplexLinearForm & b)
 {
-  b.AddBoundaryIntegrator(_lfi_re.release(), _lfi_im.release(), _markers);
+  b.AddBoundaryIntegrator(SharedLinearFormIntegrator::Share(_lfi_re),
+                          SharedLinearFormIntegrator::Share(_lfi_im),
+                          _markers);
 }
 
 void
 IntegratedBC::ApplyBC(mfem::ParComplexLinearForm & b)
 {
-  b.AddBoundaryIntegrator(_lfi_re.release(), _lfi_im.release(), _markers);
+  b.AddBoundaryIntegrator(SharedLinearFormIntegrator::Share(_lfi_re),
+                          SharedLinearFormIntegrator::Share(_lfi_im),
+                          _markers);
 }
 
 } // namespace hephaestus
@@ -1,5 +1,6 @@
 #pragma once
 #include "boundary_condition_base.hpp"
+#include "shared_integrators.hpp"
 
 namespace hephaestus
 {
@@ -13,8 +14,10 @@ public:
                std::unique_ptr<mfem::LinearFormIntegrator> lfi_re_,
                std::unique_ptr<mfem::LinearFormIntegrator> lfi_im_ = nullptr);
 
-  std::unique_ptr<mfem::LinearFormIntegrator> _lfi_re;
-  std::unique_ptr<mfem::LinearFormIntegrator> _lfi_im;
+  // Shared with the linear forms the BC is applied to, so the BC can be applied to a new form each
+  // time one is built.
+  std::shared_ptr<mfem::LinearFormIntegrator> _lfi_re;
+  std::shared_ptr<mfem::LinearFormIntegrator> _lfi_im;
 
   void ApplyBC(mfem::LinearForm & b) override;
   void ApplyBC(mfem::ComplexLinearForm & b) override;
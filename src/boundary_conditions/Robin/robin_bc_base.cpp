@@ -18,15 +18,19 @@ RobinBC::RobinBC(const std::string & name_,
 void
 RobinBC::ApplyBC(mfem::ParBilinearForm & a)
 {
-  // NB: ParBilinearForm assumes ownership of pointers. Release to
-  // prevent double-free!
-  a.AddBoundaryIntegrator(_blfi_re.release(), _markers);
+  // ParBilinearForm assumes ownership of the adaptor, not of the BC's integrator.
+  if (_blfi_re)
+  {
+    a.AddBoundaryIntegrator(SharedBilinearFormIntegrator::Share(_blfi_re), _markers);
+  }
 }
 
 void
 RobinBC::ApplyBC(mfem::ParSesquilinearForm & a)
 {
-  a.AddBoundaryIntegrator(_blfi_re.release(), _blfi_im.release(), _markers);
+  a.AddBoundaryIntegrator(SharedBilinearFormIntegrator::Share(_blfi_re),
+                          SharedBilinearFormIntegrator::Share(_blfi_im),
+                          _markers);
 }
 
 } // namespace hephaestus
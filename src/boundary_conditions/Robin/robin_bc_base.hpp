@@ -14,8 +14,8 @@ public:
           std::unique_ptr<mfem::BilinearFormIntegrator> blfi_im_ = nullptr,
           std::unique_ptr<mfem::LinearFormIntegrator> lfi_im_ = nullptr);
 
-  std::unique_ptr<mfem::BilinearFormIntegrator> _blfi_re{nullptr};
-  std::unique_ptr<mfem::BilinearFormIntegrator> _blfi_im{nullptr};
+  std::shared_ptr<mfem::BilinearFormIntegrator> _blfi_re{nullptr};
+  std::shared_ptr<mfem::BilinearFormIntegrator> _blfi_im{nullptr};
 
   virtual void ApplyBC(mfem::ParBilinearForm & a);
   virtual void ApplyBC(mfem::ParSesquilinearForm & a);
@@ -17,4 +17,14 @@ BoundaryCondition::GetMarkers(mfem::Mesh & mesh)
   return _markers;
 }
 
+mfem::Array<int> &
+BoundaryCondition::GetCachedMarkers(mfem::Mesh & mesh)
+{
+  if (_markers.Size() != mesh.bdr_attributes.Max())
+  {
+    GetMarkers(mesh);
+  }
+  return _markers;
+}
+
 } // namespace hephaestus
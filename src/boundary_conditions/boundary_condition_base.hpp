@@ -14,6 +14,10 @@ public:
   BoundaryCondition(std::string name_, mfem::Array<int> bdr_attributes_);
   mfem::Array<int> GetMarkers(mfem::Mesh & mesh);
 
+  /// Returns the boundary markers, recomputing them only if the number of boundary attributes of
+  /// the mesh has changed since they were last computed.
+  mfem::Array<int> & GetCachedMarkers(mfem::Mesh & mesh);
+
   std::string _name;
   mfem::Array<int> _bdr_attributes;
   mfem::Array<int> _markers;
@@ -3,30 +3,78 @@
 namespace hephaestus
 {
 
-mfem::Array<int>
-BCMap::GetEssentialBdrMarkers(const std::string & name_, mfem::Mesh * mesh_)
+BCMap::BCPlan &
+BCMap::GetPlan(const std::string & name_, mfem::Mesh * mesh_)
 {
-  mfem::Array<int> global_ess_markers(mesh_->bdr_attributes.Max());
-  global_ess_markers = 0;
-  mfem::Array<int> ess_bdrs(mesh_->bdr_attributes.Max());
-  ess_bdrs = 0;
+  auto & plan = _plans[name_];
+
+  if (plan._mesh == mesh_ && plan._mesh_sequence == mesh_->GetSequence() &&
+      plan._revision == GetRevision())
+  {
+    return plan;
+  }
+
+  plan = BCPlan();
+  plan._revision = GetRevision();
+  plan._mesh = mesh_;
+  plan._mesh_sequence = mesh_->GetSequence();
+
+  plan._ess_bdr_markers.SetSize(mesh_->bdr_attributes.Max());
+  plan._ess_bdr_markers = 0;
 
   for (auto const & [name, bc_] : *this)
   {
-    if (bc_->_name == name_)
+    if (bc_->_name != name_)
+    {
+      continue;
+    }
+
+    // Boundary markers are computed once here, and reused by the BCs on each application.
+    bc_->GetMarkers(*mesh_);
+
+    if (auto bc = dynamic_cast<hephaestus::EssentialBC *>(bc_.get()))
     {
-      auto bc = std::dynamic_pointer_cast<hephaestus::EssentialBC>(bc_);
-      if (bc != nullptr)
+      plan._essential_bcs.push_back(bc);
+      plan._time_dependent = plan._time_dependent || bc->IsTimeDependent();
+
+      for (auto it = 0; it != mesh_->bdr_attributes.Max(); ++it)
       {
-        ess_bdrs = bc->GetMarkers(*mesh_);
-        for (auto it = 0; it != mesh_->bdr_attributes.Max(); ++it)
-        {
-          global_ess_markers[it] = std::max(global_ess_markers[it], ess_bdrs[it]);
-        }
+        plan._ess_bdr_markers[it] = std::max(plan._ess_bdr_markers[it], bc->_markers[it]);
       }
     }
+    if (auto bc = dynamic_cast<hephaestus::IntegratedBC *>(bc_.get()))
+    {
+      plan._integrated_bcs.push_back(bc);
+    }
+    if (auto bc = dynamic_cast<hephaestus::RobinBC *>(bc_.get()))
+    {
+      plan._robin_bcs.push_back(bc);
+    }
   }
-  return global_ess_markers;
+
+  return plan;
+}
+
+const mfem::Array<int> &
+BCMap::GetPlanTrueDofs(BCPlan & plan, mfem::FiniteElementSpace & fespace)
+{
+  // GetEssentialTrueDofs requires parallel communication for ParFiniteElementSpaces, so the list
+  // is only recomputed when the space changes.
+  if (plan._fespace != &fespace || plan._fespace_sequence != fespace.GetSequence() ||
+      plan._fespace_true_vsize != fespace.GetTrueVSize())
+  {
+    fespace.GetEssentialTrueDofs(plan._ess_bdr_markers, plan._ess_tdof_list);
+    plan._fespace = &fespace;
+    plan._fespace_sequence = fespace.GetSequence();
+    plan._fespace_true_vsize = fespace.GetTrueVSize();
+  }
+  return plan._ess_tdof_list;
+}
+
+mfem::Array<int>
+BCMap::GetEssentialBdrMarkers(const std::string & name_, mfem::Mesh * mesh_)
+{
+  return GetPlan(name_, mesh_)._ess_bdr_markers;
 }
 
 void
@@ -35,19 +83,12 @@ BCMap::ApplyEssentialBCs(const std::string & name_,
                          mfem::GridFunction & gridfunc,
                          mfem::Mesh * mesh_)
 {
-  for (auto const & [name, bc_] : *this)
+  auto & plan = GetPlan(name_, mesh_);
+  for (auto * bc : plan._essential_bcs)
   {
-    if (bc_->_name == name_)
-    {
-      auto bc = std::dynamic_pointer_cast<hephaestus::EssentialBC>(bc_);
-      if (bc != nullptr)
-      {
-        bc->ApplyBC(gridfunc, mesh_);
-      }
-    }
+    bc->ApplyBC(gridfunc, mesh_);
   }
-  mfem::Array<int> ess_bdr = GetEssentialBdrMarkers(name_, mesh_);
-  gridfunc.FESpace()->GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+  ess_tdof_list = GetPlanTrueDofs(plan, *gridfunc.FESpace());
 }
 
 void
@@ -56,36 +97,35 @@ BCMap::ApplyEssentialBCs(const std::string & name_,
                          mfem::ParComplexGridFunction & gridfunc,
                          mfem::Mesh * mesh_)
 {
-  for (auto const & [name, bc_] : *this)
+  auto & plan = GetPlan(name_, mesh_);
+  for (auto * bc : plan._essential_bcs)
   {
-    if (bc_->_name == name_)
-    {
-      auto bc = std::dynamic_pointer_cast<hephaestus::EssentialBC>(bc_);
-      if (bc != nullptr)
-      {
-        bc->ApplyBC(gridfunc, mesh_);
-      }
-    }
+    bc->ApplyBC(gridfunc, mesh_);
   }
-  mfem::Array<int> ess_bdr = GetEssentialBdrMarkers(name_, mesh_);
-  gridfunc.FESpace()->GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+  ess_tdof_list = GetPlanTrueDofs(plan, *gridfunc.FESpace());
 };
 
 void
-BCMap::ApplyIntegratedBCs(const std::string & name_, mfem::LinearForm & lf, mfem::Mesh * mesh_)
+BCMap::GetEssentialTrueDofs(const std::string & name_,
+                            mfem::Array<int> & ess_tdof_list,
+                            mfem::FiniteElementSpace & fespace,
+                            mfem::Mesh * mesh_)
 {
+  ess_tdof_list = GetPlanTrueDofs(GetPlan(name_, mesh_), fespace);
+}
 
-  for (auto const & [name, bc_] : *this)
+bool
+BCMap::HasTimeDependentEssentialBCs(const std::string & name_, mfem::Mesh * mesh_)
+{
+  return GetPlan(name_, mesh_)._time_dependent;
+}
+
+void
+BCMap::ApplyIntegratedBCs(const std::string & name_, mfem::LinearForm & lf, mfem::Mesh * mesh_)
+{
+  for (auto * bc : GetPlan(name_, mesh_)._integrated_bcs)
   {
-    if (bc_->_name == name_)
-    {
-      auto bc = std::dynamic_pointer_cast<hephaestus::IntegratedBC>(bc_);
-      if (bc != nullptr)
-      {
-        bc->GetMarkers(*mesh_);
-        bc->ApplyBC(lf);
-      }
-    }
+    bc->ApplyBC(lf);
   }
 };
 
@@ -94,18 +134,9 @@ BCMap::ApplyIntegratedBCs(const std::string & name_,
                           mfem::ParComplexLinearForm & clf,
                           mfem::Mesh * mesh_)
 {
-
-  for (auto const & [name, bc_] : *this)
+  for (auto * bc : GetPlan(name_, mesh_)._integrated_bcs)
   {
-    if (bc_->_name == name_)
-    {
-      auto bc = std::dynamic_pointer_cast<hephaestus::IntegratedBC>(bc_);
-      if (bc != nullptr)
-      {
-        bc->GetMarkers(*mesh_);
-        bc->ApplyBC(clf);
-      }
-    }
+    bc->ApplyBC(clf);
   }
 };
 
@@ -114,17 +145,9 @@ BCMap::ApplyIntegratedBCs(const std::string & name_,
                           mfem::ParSesquilinearForm & slf,
                           mfem::Mesh * mesh_)
 {
-  for (auto const & [name, bc_] : *this)
+  for (auto * bc : GetPlan(name_, mesh_)._robin_bcs)
   {
-    if (bc_->_name == name_)
-    {
-      auto bc = std::dynamic_pointer_cast<hephaestus::RobinBC>(bc_);
-      if (bc != nullptr)
-      {
-        bc->GetMarkers(*mesh_);
-        bc->ApplyBC(slf);
-      }
-    }
+    bc->ApplyBC(slf);
   }
 };
 
@@ -22,6 +22,16 @@ public:
                          mfem::ParComplexGridFunction & gridfunc,
                          mfem::Mesh * mesh_);
 
+  /// Sets ess_tdof_list to the essential true DOFs of the variable on fespace, without projecting
+  /// the boundary values.
+  void GetEssentialTrueDofs(const std::string & name_,
+                            mfem::Array<int> & ess_tdof_list,
+                            mfem::FiniteElementSpace & fespace,
+                            mfem::Mesh * mesh_);
+
+  /// Returns true if any essential BC on the variable has boundary values that may vary in time.
+  bool HasTimeDependentEssentialBCs(const std::string & name_, mfem::Mesh * mesh_);
+
   void ApplyIntegratedBCs(const std::string & name_, mfem::LinearForm & lf, mfem::Mesh * mesh_);
 
   void ApplyIntegratedBCs(const std::string & name_,
@@ -31,6 +41,35 @@ public:
   void ApplyIntegratedBCs(const std::string & name_,
                           mfem::ParSesquilinearForm & clf,
                           mfem::Mesh * mesh_);
+
+private:
+  // The BCs acting on a single variable, with their boundary markers and essential true DOFs. A
+  // plan is rebuilt when BCs are registered or deregistered, or when the mesh changes. The true
+  // DOF list is recomputed when the finite element space changes.
+  struct BCPlan
+  {
+    std::size_t _revision{0};
+    const mfem::Mesh * _mesh{nullptr};
+    long _mesh_sequence{-1};
+
+    std::vector<hephaestus::EssentialBC *> _essential_bcs;
+    std::vector<hephaestus::IntegratedBC *> _integrated_bcs;
+    std::vector<hephaestus::RobinBC *> _robin_bcs;
+    bool _time_dependent{false};
+
+    mfem::Array<int> _ess_bdr_markers;
+
+    const mfem::FiniteElementSpace * _fespace{nullptr};
+    long _fespace_sequence{-1};
+    int _fespace_true_vsize{-1};
+    mfem::Array<int> _ess_tdof_list;
+  };
+
+  BCPlan & GetPlan(const std::string & name_, mfem::Mesh * mesh_);
+
+  const mfem::Array<int> & GetPlanTrueDofs(BCPlan & plan, mfem::FiniteElementSpace & fespace);
+
+  std::map<std::string, BCPlan> _plans;
 };
 
 } // namespace hephaestus
@@ -0,0 +1,220 @@
+#include "shared_integrators.hpp"
+
+#include <utility>
+
+namespace hephaestus
+{
+
+SharedLinearFormIntegrator::SharedLinearFormIntegrator(
+    std::shared_ptr<mfem::LinearFormIntegrator> integrator)
+  : _integrator(std::move(integrator))
+{
+}
+
+void
+SharedLinearFormIntegrator::AssembleRHSElementVect(const mfem::FiniteElement & el,
+                                                   mfem::ElementTransformation & Tr,
+                                                   mfem::Vector & elvect)
+{
+  _integrator->AssembleRHSElementVect(el, Tr, elvect);
+}
+
+void
+SharedLinearFormIntegrator::AssembleRHSElementVect(const mfem::FiniteElement & el,
+                                                   mfem::FaceElementTransformations & Tr,
+                                                   mfem::Vector & elvect)
+{
+  _integrator->AssembleRHSElementVect(el, Tr, elvect);
+}
+
+void
+SharedLinearFormIntegrator::AssembleRHSElementVect(const mfem::FiniteElement & el1,
+                                                   const mfem::FiniteElement & el2,
+                                                   mfem::FaceElementTransformations & Tr,
+                                                   mfem::Vector & elvect)
+{
+  _integrator->AssembleRHSElementVect(el1, el2, Tr, elvect);
+}
+
+bool
+SharedLinearFormIntegrator::SupportsDevice() const
+{
+  return _integrator->SupportsDevice();
+}
+
+void
+SharedLinearFormIntegrator::AssembleDevice(const mfem::FiniteElementSpace & fes,
+                                           const mfem::Array<int> & markers,
+                                           mfem::Vector & b)
+{
+  _integrator->AssembleDevice(fes, markers, b);
+}
+
+void
+SharedLinearFormIntegrator::SetIntRule(const mfem::IntegrationRule * ir)
+{
+  mfem::LinearFormIntegrator::SetIntRule(ir);
+  _integrator->SetIntRule(ir);
+}
+
+mfem::LinearFormIntegrator *
+SharedLinearFormIntegrator::Share(const std::shared_ptr<mfem::LinearFormIntegrator> & integrator)
+{
+  return integrator ? new SharedLinearFormIntegrator(integrator) : nullptr;
+}
+
+SharedBilinearFormIntegrator::SharedBilinearFormIntegrator(
+    std::shared_ptr<mfem::BilinearFormIntegrator> integrator)
+  : _integrator(std::move(integrator))
+{
+}
+
+void
+SharedBilinearFormIntegrator::AssembleElementMatrix(const mfem::FiniteElement & el,
+                                                    mfem::ElementTransformation & Trans,
+                                                    mfem::DenseMatrix & elmat)
+{
+  _integrator->AssembleElementMatrix(el, Trans, elmat);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleElementMatrix2(const mfem::FiniteElement & trial_fe,
+                                                     const mfem::FiniteElement & test_fe,
+                                                     mfem::ElementTransformation & Trans,
+                                                     mfem::DenseMatrix & elmat)
+{
+  _integrator->AssembleElementMatrix2(trial_fe, test_fe, Trans, elmat);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleFaceMatrix(const mfem::FiniteElement & el1,
+                                                 const mfem::FiniteElement & el2,
+                                                 mfem::FaceElementTransformations & Trans,
+                                                 mfem::DenseMatrix & elmat)
+{
+  _integrator->AssembleFaceMatrix(el1, el2, Trans, elmat);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleFaceMatrix(const mfem::FiniteElement & trial_face_fe,
+                                                 const mfem::FiniteElement & test_fe1,
+                                                 const mfem::FiniteElement & test_fe2,
+                                                 mfem::FaceElementTransformations & Trans,
+                                                 mfem::DenseMatrix & elmat)
+{
+  _integrator->AssembleFaceMatrix(trial_face_fe, test_fe1, test_fe2, Trans, elmat);
+}
+
+void
+SharedBilinearFormIntegrator::AssemblePA(const mfem::FiniteElementSpace & fes)
+{
+  _integrator->AssemblePA(fes);
+}
+
+void
+SharedBilinearFormIntegrator::AssemblePA(const mfem::FiniteElementSpace & trial_fes,
+                                         const mfem::FiniteElementSpace & test_fes)
+{
+  _integrator->AssemblePA(trial_fes, test_fes);
+}
+
+void
+SharedBilinearFormIntegrator::AssemblePAInteriorFaces(const mfem::FiniteElementSpace & fes)
+{
+  _integrator->AssemblePAInteriorFaces(fes);
+}
+
+void
+SharedBilinearFormIntegrator::AssemblePABoundaryFaces(const mfem::FiniteElementSpace & fes)
+{
+  _integrator->AssemblePABoundaryFaces(fes);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleDiagonalPA(mfem::Vector & diag)
+{
+  _integrator->AssembleDiagonalPA(diag);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleDiagonalPA_ADAt(const mfem::Vector & D, mfem::Vector & diag)
+{
+  _integrator->AssembleDiagonalPA_ADAt(D, diag);
+}
+
+void
+SharedBilinearFormIntegrator::AddMultPA(const mfem::Vector & x, mfem::Vector & y) const
+{
+  _integrator->AddMultPA(x, y);
+}
+
+void
+SharedBilinearFormIntegrator::AddMultTransposePA(const mfem::Vector & x, mfem::Vector & y) const
+{
+  _integrator->AddMultTransposePA(x, y);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleEA(const mfem::FiniteElementSpace & fes,
+                                         mfem::Vector & emat,
+                                         bool add)
+{
+  _integrator->AssembleEA(fes, emat, add);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleEAInteriorFaces(const mfem::FiniteElementSpace & fes,
+                                                      mfem::Vector & ea_data_int,
+                                                      mfem::Vector & ea_data_ext,
+                                                      bool add)
+{
+  _integrator->AssembleEAInteriorFaces(fes, ea_data_int, ea_data_ext, add);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleEABoundaryFaces(const mfem::FiniteElementSpace & fes,
+                                                      mfem::Vector & ea_data_bdr,
+                                                      bool add)
+{
+  _integrator->AssembleEABoundaryFaces(fes, ea_data_bdr, add);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleMF(const mfem::FiniteElementSpace & fes)
+{
+  _integrator->AssembleMF(fes);
+}
+
+void
+SharedBilinearFormIntegrator::AssembleDiagonalMF(mfem::Vector & diag)
+{
+  _integrator->AssembleDiagonalMF(diag);
+}
+
+void
+SharedBilinearFormIntegrator::AddMultMF(const mfem::Vector & x, mfem::Vector & y) const
+{
+  _integrator->AddMultMF(x, y);
+}
+
+void
+SharedBilinearFormIntegrator::AddMultTransposeMF(const mfem::Vector & x, mfem::Vector & y) const
+{
+  _integrator->AddMultTransposeMF(x, y);
+}
+
+void
+SharedBilinearFormIntegrator::SetIntRule(const mfem::IntegrationRule * ir)
+{
+  mfem::BilinearFormIntegrator::SetIntRule(ir);
+  _integrator->SetIntRule(ir);
+}
+
+mfem::BilinearFormIntegrator *
+SharedBilinearFormIntegrator::Share(
+    const std::shared_ptr<mfem::BilinearFormIntegrator> & integrator)
+{
+  return integrator ? new SharedBilinearFormIntegrator(integrator) : nullptr;
+}
+
+} // namespace hephaestus
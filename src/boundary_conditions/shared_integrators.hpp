@@ -0,0 +1,112 @@
+#pragma once
+#include <memory>
+
+#include "mfem.hpp"
+
+namespace hephaestus
+{
+
+// MFEM forms take ownership of the integrators added to them and delete them on destruction. The
+// adaptors below let an integrator held by a boundary condition be added to any number of forms:
+// each form owns (and deletes) an adaptor, which shares ownership of the underlying integrator
+// and forwards assembly calls to it. Full, partial, element and matrix-free assembly entry points
+// are forwarded, as are the integration rule setters, which therefore change the rule of the
+// underlying integrator for every form that shares it.
+
+class SharedLinearFormIntegrator : public mfem::LinearFormIntegrator
+{
+public:
+  explicit SharedLinearFormIntegrator(std::shared_ptr<mfem::LinearFormIntegrator> integrator);
+
+  void AssembleRHSElementVect(const mfem::FiniteElement & el,
+                              mfem::ElementTransformation & Tr,
+                              mfem::Vector & elvect) override;
+
+  void AssembleRHSElementVect(const mfem::FiniteElement & el,
+                              mfem::FaceElementTransformations & Tr,
+                              mfem::Vector & elvect) override;
+
+  void AssembleRHSElementVect(const mfem::FiniteElement & el1,
+                              const mfem::FiniteElement & el2,
+                              mfem::FaceElementTransformations & Tr,
+                              mfem::Vector & elvect) override;
+
+  [[nodiscard]] bool SupportsDevice() const override;
+
+  void AssembleDevice(const mfem::FiniteElementSpace & fes,
+                      const mfem::Array<int> & markers,
+                      mfem::Vector & b) override;
+
+  void SetIntRule(const mfem::IntegrationRule * ir) override;
+
+  /// Returns an adaptor for @a integrator that a form can own, or nullptr if @a integrator is null.
+  static mfem::LinearFormIntegrator *
+  Share(const std::shared_ptr<mfem::LinearFormIntegrator> & integrator);
+
+private:
+  std::shared_ptr<mfem::LinearFormIntegrator> _integrator;
+};
+
+class SharedBilinearFormIntegrator : public mfem::BilinearFormIntegrator
+{
+public:
+  explicit SharedBilinearFormIntegrator(std::shared_ptr<mfem::BilinearFormIntegrator> integrator);
+
+  void AssembleElementMatrix(const mfem::FiniteElement & el,
+                             mfem::ElementTransformation & Trans,
+                             mfem::DenseMatrix & elmat) override;
+
+  void AssembleElementMatrix2(const mfem::FiniteElement & trial_fe,
+                              const mfem::FiniteElement & test_fe,
+                              mfem::ElementTransformation & Trans,
+                              mfem::DenseMatrix & elmat) override;
+
+  void AssembleFaceMatrix(const mfem::FiniteElement & el1,
+                          const mfem::FiniteElement & el2,
+                          mfem::FaceElementTransformations & Trans,
+                          mfem::DenseMatrix & elmat) override;
+
+  void AssembleFaceMatrix(const mfem::FiniteElement & trial_face_fe,
+                          const mfem::FiniteElement & test_fe1,
+                          const mfem::FiniteElement & test_fe2,
+                          mfem::FaceElementTransformations & Trans,
+                          mfem::DenseMatrix & elmat) override;
+
+  // Partial assembly.
+  void AssemblePA(const mfem::FiniteElementSpace & fes) override;
+  void AssemblePA(const mfem::FiniteElementSpace & trial_fes,
+                  const mfem::FiniteElementSpace & test_fes) override;
+  void AssemblePAInteriorFaces(const mfem::FiniteElementSpace & fes) override;
+  void AssemblePABoundaryFaces(const mfem::FiniteElementSpace & fes) override;
+  void AssembleDiagonalPA(mfem::Vector & diag) override;
+  void AssembleDiagonalPA_ADAt(const mfem::Vector & D, mfem::Vector & diag) override;
+  void AddMultPA(const mfem::Vector & x, mfem::Vector & y) const override;
+  void AddMultTransposePA(const mfem::Vector & x, mfem::Vector & y) const override;
+
+  // Element assembly.
+  void AssembleEA(const mfem::FiniteElementSpace & fes, mfem::Vector & emat, bool add) override;
+  void AssembleEAInteriorFaces(const mfem::FiniteElementSpace & fes,
+                               mfem::Vector & ea_data_int,
+                               mfem::Vector & ea_data_ext,
+                               bool add) override;
+  void AssembleEABoundaryFaces(const mfem::FiniteElementSpace & fes,
+                               mfem::Vector & ea_data_bdr,
+                               bool add) override;
+
+  // Matrix-free application.
+  void AssembleMF(const mfem::FiniteElementSpace & fes) override;
+  void AssembleDiagonalMF(mfem::Vector & diag) override;
+  void AddMultMF(const mfem::Vector & x, mfem::Vector & y) const override;
+  void AddMultTransposeMF(const mfem::Vector & x, mfem::Vector & y) const override;
+
+  void SetIntRule(const mfem::IntegrationRule * ir) override;
+
+  /// Returns an adaptor for @a integrator that a form can own, or nullptr if @a integrator is null.
+  static mfem::BilinearFormIntegrator *
+  Share(const std::shared_ptr<mfem::BilinearFormIntegrator> & integrator);
+
+private:
+  std::shared_ptr<mfem::BilinearFormIntegrator> _integrator;
+};
+
+} // namespace hephaestus
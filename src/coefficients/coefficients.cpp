@@ -16,6 +16,37 @@ fracFunc(double a, double b)
   return a / b;
 }
 
+bool
+SupportMarkers(const mfem::Array<int> & support,
+               const mfem::Mesh & mesh,
+               mfem::Array<int> & markers)
+{
+  if (mesh.attributes.Size() == 0)
+  {
+    return false;
+  }
+
+  const int max_attribute = mesh.attributes.Max();
+  markers.SetSize(max_attribute);
+  markers = 0;
+  for (int attribute : support)
+  {
+    if (attribute > 0 && attribute <= max_attribute)
+    {
+      markers[attribute - 1] = 1;
+    }
+  }
+
+  for (int attribute : mesh.attributes)
+  {
+    if (!markers[attribute - 1])
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 Subdomain::Subdomain(std::string name_, int id_) : _name(std::move(name_)), _id(id_) {}
 
 Coefficients::Coefficients() { RegisterDefaultCoefficients(); }
@@ -46,6 +77,77 @@ Coefficients::SetTime(double time)
   _t = time;
 }
 
+void
+Coefficients::SetSupport(const std::string & name, const mfem::Array<int> & attributes)
+{
+  _scalar_supports[name] = attributes;
+  _subdomain_scalars.erase(name);
+  _shared_supports.erase(name);
+}
+
+void
+Coefficients::ShareSupport(const std::string & name, const std::string & source_name)
+{
+  _scalar_supports.erase(name);
+  _subdomain_scalars.erase(name);
+  _shared_supports[name] = source_name;
+}
+
+void
+Coefficients::UpdateSubdomainSupports() const
+{
+  if (_supports_revision == GetRevision())
+  {
+    return;
+  }
+
+  // Subdomains where the property is a constant zero (e.g. conductivity in air) lie outside its
+  // support, so terms using it need not be assembled there.
+  for (const auto & [name, subdomain_scalar] : _subdomain_scalars)
+  {
+    const auto & [subdomain_ids, subdomain_coefs] = subdomain_scalar;
+    mfem::Array<int> support;
+    for (int i = 0; i < subdomain_ids.Size(); ++i)
+    {
+      auto * constant = dynamic_cast<mfem::ConstantCoefficient *>(subdomain_coefs[i]);
+      if (constant == nullptr || constant->constant != 0.0)
+      {
+        support.Append(subdomain_ids[i]);
+      }
+    }
+    _scalar_supports[name] = support;
+  }
+  _supports_revision = GetRevision();
+}
+
+bool
+Coefficients::GetSupport(const std::string & name, mfem::Array<int> & attributes) const
+{
+  auto shared = _shared_supports.find(name);
+  if (shared != _shared_supports.end())
+  {
+    return GetSupport(shared->second, attributes);
+  }
+
+  UpdateSubdomainSupports();
+  auto it = _scalar_supports.find(name);
+  if (it == _scalar_supports.end())
+  {
+    return false;
+  }
+  attributes = it->second;
+  return true;
+}
+
+bool
+Coefficients::GetSupportMarkers(const std::string & name,
+                                const mfem::Mesh & mesh,
+                                mfem::Array<int> & markers) const
+{
+  mfem::Array<int> support;
+  return GetSupport(name, support) && SupportMarkers(support, mesh, markers);
+}
+
 // merge subdomains?
 void
 Coefficients::AddGlobalCoefficientsFromSubdomains()
@@ -90,6 +192,10 @@ Coefficients::AddGlobalCoefficientsFromSubdomains()
     {
       _scalars.Register(scalar_property_name,
                         std::make_shared<mfem::PWCoefficient>(subdomain_ids, subdomain_coefs));
+
+      // The support is computed from the subdomain values on request, and recomputed whenever
+      // the coefficients are registered or marked as modified.
+      _subdomain_scalars[scalar_property_name] = {subdomain_ids, subdomain_coefs};
     }
   }
 
@@ -3,8 +3,10 @@
 #include "named_fields_map.hpp"
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <unordered_set>
+#include <utility>
 
 namespace hephaestus
 {
@@ -12,6 +14,12 @@ namespace hephaestus
 double prodFunc(double a, double b);
 double fracFunc(double a, double b);
 
+/// Sets markers to flag the attributes of mesh listed in support. Returns false if support covers
+/// every attribute of the mesh, in which case no restriction is needed.
+bool SupportMarkers(const mfem::Array<int> & support,
+                    const mfem::Mesh & mesh,
+                    mfem::Array<int> & markers);
+
 class Subdomain
 {
 public:
@@ -41,9 +49,47 @@ public:
   void AddGlobalCoefficientsFromSubdomains();
   void RegisterDefaultCoefficients();
 
+  /// Records the mesh attributes outside of which the named scalar coefficient is zero.
+  void SetSupport(const std::string & name, const mfem::Array<int> & attributes);
+
+  /// Records that the named scalar coefficient is zero wherever the coefficient @a source_name
+  /// is, so that its support follows any change to the support of @a source_name.
+  void ShareSupport(const std::string & name, const std::string & source_name);
+
+  /// Sets attributes to the support of the named scalar coefficient. Returns false if no support
+  /// has been recorded, in which case the coefficient may be non-zero anywhere.
+  bool GetSupport(const std::string & name, mfem::Array<int> & attributes) const;
+
+  /// Sets markers to flag the attributes of mesh in the support of the named scalar coefficient.
+  /// Returns false if the coefficient may be non-zero on every attribute of the mesh, in which
+  /// case integrators using it should be assembled over the whole domain.
+  bool GetSupportMarkers(const std::string & name,
+                         const mfem::Mesh & mesh,
+                         mfem::Array<int> & markers) const;
+
+  /// Returns a counter that increases whenever scalar or vector coefficients are registered,
+  /// deregistered or marked as modified in place.
+  [[nodiscard]] std::size_t GetRevision() const
+  {
+    return _scalars.GetRevision() + _vectors.GetRevision();
+  }
+
   hephaestus::NamedFieldsMap<mfem::Coefficient> _scalars;
   hephaestus::NamedFieldsMap<mfem::VectorCoefficient> _vectors;
   std::vector<Subdomain> _subdomains;
+
+private:
+  // Recomputes the supports of the global coefficients built from subdomains if the coefficients
+  // have changed since they were last computed, as a subdomain value may have been set to or from
+  // zero in place.
+  void UpdateSubdomainSupports() const;
+
+  // Subdomain IDs and coefficients of each global scalar coefficient built from subdomains.
+  std::map<std::string, std::pair<mfem::Array<int>, mfem::Array<mfem::Coefficient *>>>
+      _subdomain_scalars;
+  mutable std::map<std::string, mfem::Array<int>> _scalar_supports;
+  std::map<std::string, std::string> _shared_supports;
+  mutable std::size_t _supports_revision{0};
 };
 
 } // namespace hephaestus
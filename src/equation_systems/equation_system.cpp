@@ -3,7 +3,88 @@
 namespace hephaestus
 {
 
-EquationSystem::~EquationSystem() { _h_blocks.DeleteAll(); }
+EquationSystem::~EquationSystem() { DeleteBlocks(); }
+
+void
+EquationSystem::DeleteBlocks()
+{
+  // The blocks reference matrices owned by the forms, so deleting them frees no matrix data.
+  for (int i = 0; i < _h_blocks.NumRows(); i++)
+  {
+    for (int j = 0; j < _h_blocks.NumCols(); j++)
+    {
+      delete _h_blocks(i, j);
+    }
+  }
+  _h_blocks.DeleteAll();
+}
+
+void
+EquationSystem::ReleaseAssembledForms()
+{
+  DeleteBlocks();
+
+  for (int i = 0; i < _test_var_names.size(); i++)
+  {
+    // Frees the local and parallel matrices; the integrators are kept so the form can be
+    // reassembled. Condensed forms are kept, as they hold the element data needed to recover
+    // the interior DOFs.
+    if (!UsesStaticCondensation())
+    {
+      _blfs.Get(_blf_handles[i])->Update();
+    }
+
+    auto & test_mblfs = _mblfs.GetRef(_mblf_test_handles[i]);
+    for (int j = 0; j < _test_var_names.size(); j++)
+    {
+      if (test_mblfs.Has(_mblf_trial_handles[i][j]))
+      {
+        test_mblfs.Deregister(_test_var_names.at(j));
+      }
+    }
+  }
+}
+
+void
+EquationSystem::SetStaticCondensation(bool static_condensation)
+{
+  _static_condensation = static_condensation;
+
+  if (_static_condensation && !UsesStaticCondensation())
+  {
+    logger.warn("Static condensation is only applied to equation systems with a single test "
+                "variable and no mixed bilinear forms. The full system is formed.");
+  }
+}
+
+bool
+EquationSystem::UsesStaticCondensation() const
+{
+  return _static_condensation && _test_var_names.size() == 1 &&
+         !_mblf_kernels_map_map.Has(_test_var_names.at(0));
+}
+
+mfem::ParFiniteElementSpace *
+EquationSystem::GetSystemFESpace(int i)
+{
+  auto * fespace = _test_pfespaces.at(i);
+  if (!UsesStaticCondensation())
+  {
+    return fespace;
+  }
+
+  if (_trace_fespace == nullptr)
+  {
+    // Built as the condensed bilinear form builds its own, so that the two share a DOF layout.
+    _trace_fec.reset(fespace->FEColl()->GetTraceCollection());
+    _trace_fespace = std::make_unique<mfem::ParFiniteElementSpace>(
+        fespace->GetParMesh(), _trace_fec.get(), fespace->GetVDim(), fespace->GetOrdering());
+  }
+
+  // Static condensation is dropped by the bilinear form when there are no interior DOFs.
+  return (_trace_fespace->GetTrueVSize() < fespace->GetTrueVSize()) ? _trace_fespace.get()
+                                                                     : fespace;
+}
 
 bool
 EquationSystem::VectorContainsName(const std::vector<std::string> & the_vector,
@@ -117,16 +198,32 @@ void
 EquationSystem::ApplyBoundaryConditions(hephaestus::BCMap & bc_map)
 {
   _ess_tdof_lists.resize(_test_var_names.size());
+  _xs_projected_stamps.resize(_test_var_names.size(), {-1, 0, 0});
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto test_var_name = _test_var_names.at(i);
-    // Set default value of gridfunction used in essential BC. Values
-    // overwritten in applyEssentialBCs
-    *(_xs.at(i)) = 0.0;
-    bc_map.ApplyEssentialBCs(
-        test_var_name, _ess_tdof_lists.at(i), *(_xs.at(i)), _test_pfespaces.at(i)->GetParMesh());
-    bc_map.ApplyIntegratedBCs(
-        test_var_name, _lfs.GetRef(test_var_name), _test_pfespaces.at(i)->GetParMesh());
+    const auto & test_var_name = _test_var_names.at(i);
+    auto * mesh = _test_pfespaces.at(i)->GetParMesh();
+
+    const std::tuple<long, std::size_t, std::size_t> stamp(
+        _xs.at(i)->ParFESpace()->GetSequence(),
+        bc_map.GetRevision(),
+        _coefficients ? _coefficients->GetRevision() : 0);
+    if (_xs_projected_stamps.at(i) == stamp &&
+        !bc_map.HasTimeDependentEssentialBCs(test_var_name, mesh))
+    {
+      // Dirichlet values are fixed in time and already held in _xs.
+      bc_map.GetEssentialTrueDofs(
+          test_var_name, _ess_tdof_lists.at(i), *_xs.at(i)->ParFESpace(), mesh);
+    }
+    else
+    {
+      // Set default value of gridfunction used in essential BC. Values
+      // overwritten in applyEssentialBCs
+      *(_xs.at(i)) = 0.0;
+      bc_map.ApplyEssentialBCs(test_var_name, _ess_tdof_lists.at(i), *(_xs.at(i)), mesh);
+      _xs_projected_stamps.at(i) = stamp;
+    }
+    bc_map.ApplyIntegratedBCs(test_var_name, _lfs.GetRef(_lf_handles.at(i)), mesh);
   }
 }
 void
@@ -136,36 +233,65 @@ EquationSystem::FormLinearSystem(mfem::OperatorHandle & op,
 {
 
   // Allocate block operator
-  _h_blocks.DeleteAll();
+  DeleteBlocks();
   _h_blocks.SetSize(_test_var_names.size(), _test_var_names.size());
-  // Form diagonal blocks.
+  _h_blocks = nullptr;
+
+  if (UsesStaticCondensation())
+  {
+    // The condensed system is posed on the trace space, which has fewer true DOFs than the test
+    // variable.
+    auto * blf = _blfs.Get(_blf_handles[0]);
+    const int system_size = blf->StaticCondensationIsEnabled()
+                                ? blf->SCParFESpace()->GetTrueVSize()
+                                : _test_pfespaces.at(0)->GetTrueVSize();
+    if (trueX.Size() != system_size)
+    {
+      _system_true_offsets.SetSize(2);
+      _system_true_offsets[0] = 0;
+      _system_true_offsets[1] = system_size;
+      trueX.Update(_system_true_offsets);
+      trueRHS.Update(_system_true_offsets);
+    }
+  }
+
+  // Form diagonal blocks. The true DOF vectors are written straight into the blocks of trueX and
+  // trueRHS, which are views into their storage.
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto & test_var_name = _test_var_names.at(i);
-    auto blf = _blfs.Get(test_var_name);
-    auto lf = _lfs.Get(test_var_name);
-    mfem::Vector aux_x, aux_rhs;
+    auto blf = _blfs.Get(_blf_handles[i]);
+    auto lf = _lfs.Get(_lf_handles[i]);
     _h_blocks(i, i) = new mfem::HypreParMatrix;
-    blf->FormLinearSystem(
-        _ess_tdof_lists.at(i), *(_xs.at(i)), *lf, *_h_blocks(i, i), aux_x, aux_rhs);
-    trueX.GetBlock(i) = aux_x;
-    trueRHS.GetBlock(i) = aux_rhs;
+    blf->FormLinearSystem(_ess_tdof_lists.at(i),
+                          *(_xs.at(i)),
+                          *lf,
+                          *_h_blocks(i, i),
+                          trueX.GetBlock(i),
+                          trueRHS.GetBlock(i));
+    if (_lean_assembly)
+    {
+      // The local matrix is not needed once the parallel matrix has been formed.
+      delete blf->LoseMat();
+    }
   }
 
-  // Form off-diagonal blocks
+  // Form off-diagonal blocks. Temporaries are taken from the scratch pool, sized so that MFEM
+  // does not need to resize them.
+  auto & scratch = GetScratchPool();
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto test_var_name = _test_var_names.at(i);
+    auto & test_mblfs = _mblfs.GetRef(_mblf_test_handles[i]);
     for (int j = 0; j < _test_var_names.size(); j++)
     {
-      auto trial_var_name = _test_var_names.at(j);
-
-      mfem::Vector aux_x, aux_rhs;
-      mfem::ParLinearForm aux_lf(_test_pfespaces.at(i));
-      aux_lf = 0.0;
-      if (_mblfs.Has(test_var_name) && _mblfs.Get(test_var_name)->Has(trial_var_name))
+      if (test_mblfs.Has(_mblf_trial_handles[i][j]))
       {
-        auto mblf = _mblfs.Get(test_var_name)->Get(trial_var_name);
+        auto mblf = test_mblfs.Get(_mblf_trial_handles[i][j]);
+        auto & aux_x = scratch.GetVector("EquationSystem::aux_x", trueX.GetBlock(j).Size());
+        auto & aux_rhs = scratch.GetVector("EquationSystem::aux_rhs", trueRHS.GetBlock(i).Size());
+        auto & aux_lf_data =
+            scratch.GetVector("EquationSystem::aux_lf", _test_pfespaces.at(i)->GetVSize());
+        mfem::ParLinearForm aux_lf(_test_pfespaces.at(i), aux_lf_data.GetData());
+        aux_lf = 0.0;
         _h_blocks(i, j) = new mfem::HypreParMatrix;
         mblf->FormRectangularLinearSystem(_ess_tdof_lists.at(j),
                                           _ess_tdof_lists.at(i),
@@ -174,6 +300,10 @@ EquationSystem::FormLinearSystem(mfem::OperatorHandle & op,
                                           *_h_blocks(i, j),
                                           aux_x,
                                           aux_rhs);
+        if (_lean_assembly)
+        {
+          delete mblf->LoseMat();
+        }
         trueRHS.GetBlock(i) += aux_rhs;
       }
     }
@@ -181,20 +311,94 @@ EquationSystem::FormLinearSystem(mfem::OperatorHandle & op,
   // Sync memory
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    trueX.GetBlock(0).SyncAliasMemory(trueX);
-    trueRHS.GetBlock(0).SyncAliasMemory(trueRHS);
+    trueX.GetBlock(i).SyncAliasMemory(trueX);
+    trueRHS.GetBlock(i).SyncAliasMemory(trueRHS);
   }
 
   // Create monolithic matrix
   op.Reset(mfem::HypreParMatrixFromBlocks(_h_blocks));
+
+  if (_lean_assembly)
+  {
+    ReleaseAssembledForms();
+  }
+}
+
+void
+EquationSystem::FormRightHandSide(hephaestus::BCMap & bc_map,
+                                  hephaestus::Sources & sources,
+                                  mfem::BlockVector & trueRHS)
+{
+  if (_lean_assembly || UsesStaticCondensation())
+  {
+    MFEM_ABORT("The right-hand side can only be formed separately from the operator if the "
+               "assembled forms are kept.");
+  }
+
+  BuildLinearForms(bc_map, sources);
+
+  // Diagonal blocks: the Dirichlet values are eliminated with the eliminated part of the operator
+  // kept by each bilinear form.
+  auto & scratch = GetScratchPool();
+  for (int i = 0; i < _test_var_names.size(); i++)
+  {
+    auto & x_true =
+        scratch.GetVector("EquationSystem::aux_x", _test_pfespaces.at(i)->GetTrueVSize());
+    _xs.at(i)->GetTrueDofs(x_true);
+    _lfs.Get(_lf_handles[i])->ParallelAssemble(trueRHS.GetBlock(i));
+    _blfs.Get(_blf_handles[i])->EliminateVDofsInRHS(
+        _ess_tdof_lists.at(i), x_true, trueRHS.GetBlock(i));
+  }
+
+  // Off-diagonal blocks: the columns of the essential trial DOFs are applied with the local mixed
+  // matrices, and the rows of the essential test DOFs are left unchanged, as FormLinearSystem does.
+  mfem::Vector ess_values;
+  for (int i = 0; i < _test_var_names.size(); i++)
+  {
+    auto & test_mblfs = _mblfs.GetRef(_mblf_test_handles[i]);
+    for (int j = 0; j < _test_var_names.size(); j++)
+    {
+      if (test_mblfs.Has(_mblf_trial_handles[i][j]))
+      {
+        auto * trial_pfespace = _test_pfespaces.at(j);
+        auto * test_pfespace = _test_pfespaces.at(i);
+        auto & x_true = scratch.GetVector("EquationSystem::aux_x", trial_pfespace->GetTrueVSize());
+        auto & x_ess =
+            scratch.GetVector("EquationSystem::aux_x_ess", trial_pfespace->GetTrueVSize());
+        auto & x_local =
+            scratch.GetVector("EquationSystem::aux_x_local", trial_pfespace->GetVSize());
+        auto & rhs_local =
+            scratch.GetVector("EquationSystem::aux_rhs_local", test_pfespace->GetVSize());
+        auto & aux_rhs =
+            scratch.GetVector("EquationSystem::aux_rhs", test_pfespace->GetTrueVSize());
+
+        _xs.at(j)->GetTrueDofs(x_true);
+        x_true.GetSubVector(_ess_tdof_lists.at(j), ess_values);
+        x_ess = 0.0;
+        x_ess.SetSubVector(_ess_tdof_lists.at(j), ess_values);
+
+        trial_pfespace->GetProlongationMatrix()->Mult(x_ess, x_local);
+        test_mblfs.Get(_mblf_trial_handles[i][j])->Mult(x_local, rhs_local);
+        test_pfespace->GetProlongationMatrix()->MultTranspose(rhs_local, aux_rhs);
+        aux_rhs.SetSubVector(_ess_tdof_lists.at(i), 0.0);
+        trueRHS.GetBlock(i) -= aux_rhs;
+      }
+    }
+  }
+
+  for (int i = 0; i < _test_var_names.size(); i++)
+  {
+    trueRHS.GetBlock(i).SyncAliasMemory(trueRHS);
+  }
 }
 
 void
 EquationSystem::BuildJacobian(mfem::BlockVector & trueX, mfem::BlockVector & trueRHS)
 {
+  // Sized after forming, as static condensation reduces the system.
+  FormLinearSystem(_jacobian, trueX, trueRHS);
   height = trueX.Size();
   width = trueRHS.Size();
-  FormLinearSystem(_jacobian, trueX, trueRHS);
 }
 
 void
@@ -215,9 +419,19 @@ EquationSystem::RecoverFEMSolution(mfem::BlockVector & trueX,
 {
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto & test_var_name = _test_var_names.at(i);
+    const auto & test_var_name = _test_var_names.at(i);
     trueX.GetBlock(i).SyncAliasMemory(trueX);
-    gridfunctions.Get(test_var_name)->Distribute(&(trueX.GetBlock(i)));
+    auto * blf = _blfs.Get(_blf_handles[i]);
+    if (UsesStaticCondensation() && blf->StaticCondensationIsEnabled())
+    {
+      // Recovers the interior DOFs element by element from the trace solution.
+      blf->RecoverFEMSolution(
+          trueX.GetBlock(i), *_lfs.Get(_lf_handles[i]), *gridfunctions.Get(test_var_name));
+    }
+    else
+    {
+      gridfunctions.Get(test_var_name)->Distribute(&(trueX.GetBlock(i)));
+    }
   }
 }
 
@@ -228,8 +442,11 @@ EquationSystem::Init(hephaestus::GridFunctions & gridfunctions,
                      hephaestus::Coefficients & coefficients)
 {
 
+  _coefficients = &coefficients;
+
   // Add optional kernels to the EquationSystem
   AddKernels();
+  RegisterMissingGridFunctions(gridfunctions);
 
   for (auto & test_var_name : _test_var_names)
   {
@@ -282,6 +499,22 @@ EquationSystem::Init(hephaestus::GridFunctions & gridfunctions,
       }
     }
   }
+
+  // Resolve handles to the weak form components. The mixed bilinear form maps are registered
+  // here, once, and filled each time the mixed bilinear forms are built.
+  _blf_handles = _blfs.GetHandles(_test_var_names);
+  _lf_handles = _lfs.GetHandles(_test_var_names);
+  _mblf_test_handles = _mblfs.GetHandles(_test_var_names);
+  _mblf_trial_handles.clear();
+  for (auto & test_var_name : _test_var_names)
+  {
+    if (!_mblfs.Has(test_var_name))
+    {
+      _mblfs.Register(test_var_name,
+                      std::make_shared<hephaestus::NamedFieldsMap<mfem::ParMixedBilinearForm>>());
+    }
+    _mblf_trial_handles.push_back(_mblfs.GetRef(test_var_name).GetHandles(_test_var_names));
+  }
 }
 
 void
@@ -290,23 +523,24 @@ EquationSystem::BuildLinearForms(hephaestus::BCMap & bc_map, hephaestus::Sources
   // Register linear forms
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto test_var_name = _test_var_names.at(i);
+    const auto & test_var_name = _test_var_names.at(i);
     _lfs.Register(test_var_name, std::make_shared<mfem::ParLinearForm>(_test_pfespaces.at(i)));
-    _lfs.GetRef(test_var_name) = 0.0;
+    _lfs.GetRef(_lf_handles.at(i)) = 0.0;
   }
   // Apply boundary conditions
   ApplyBoundaryConditions(bc_map);
 
-  for (auto & test_var_name : _test_var_names)
+  for (int i = 0; i < _test_var_names.size(); i++)
   {
+    const auto & test_var_name = _test_var_names.at(i);
     // Apply kernels
-    auto lf = _lfs.Get(test_var_name);
+    auto lf = _lfs.Get(_lf_handles.at(i));
     // Assemble. Must be done before applying kernels that add to lf.
     lf->Assemble();
 
     if (_lf_kernels_map.Has(test_var_name))
     {
-      auto lf_kernels = _lf_kernels_map.GetRef(test_var_name);
+      auto & lf_kernels = _lf_kernels_map.GetRef(test_var_name);
 
       for (auto & lf_kernel : lf_kernels)
       {
@@ -314,7 +548,7 @@ EquationSystem::BuildLinearForms(hephaestus::BCMap & bc_map, hephaestus::Sources
       }
     }
 
-    if (test_var_name == _test_var_names.at(0))
+    if (i == 0)
     {
       sources.Apply(lf);
     }
@@ -327,14 +561,18 @@ EquationSystem::BuildBilinearForms()
   // Register bilinear forms
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto test_var_name = _test_var_names.at(i);
+    const auto & test_var_name = _test_var_names.at(i);
     _blfs.Register(test_var_name, std::make_shared<mfem::ParBilinearForm>(_test_pfespaces.at(i)));
 
     // Apply kernels
-    auto blf = _blfs.Get(test_var_name);
+    auto blf = _blfs.Get(_blf_handles.at(i));
+    if (UsesStaticCondensation())
+    {
+      blf->EnableStaticCondensation();
+    }
     if (_blf_kernels_map.Has(test_var_name))
     {
-      auto blf_kernels = _blf_kernels_map.GetRef(test_var_name);
+      auto & blf_kernels = _blf_kernels_map.GetRef(test_var_name);
 
       for (auto & blf_kernel : blf_kernels)
       {
@@ -355,18 +593,19 @@ EquationSystem::BuildMixedBilinearForms()
   // Create mblf for each test/trial pair
   for (int i = 0; i < _test_var_names.size(); i++)
   {
-    auto test_var_name = _test_var_names.at(i);
-    auto test_mblfs = std::make_shared<hephaestus::NamedFieldsMap<mfem::ParMixedBilinearForm>>();
+    const auto & test_var_name = _test_var_names.at(i);
+    // Mixed bilinear form sets associated with a single test variable are registered in Init.
+    auto & test_mblfs = _mblfs.GetRef(_mblf_test_handles.at(i));
     for (int j = 0; j < _test_var_names.size(); j++)
     {
-      auto trial_var_name = _test_var_names.at(j);
+      const auto & trial_var_name = _test_var_names.at(j);
 
       // Register MixedBilinearForm if kernels exist for it, and assemble
       // kernels
       if (_mblf_kernels_map_map.Has(test_var_name) &&
           _mblf_kernels_map_map.Get(test_var_name)->Has(trial_var_name))
       {
-        auto mblf_kernels = _mblf_kernels_map_map.GetRef(test_var_name).GetRef(trial_var_name);
+        auto & mblf_kernels = _mblf_kernels_map_map.GetRef(test_var_name).GetRef(trial_var_name);
         auto mblf = std::make_shared<mfem::ParMixedBilinearForm>(_test_pfespaces.at(j),
                                                                  _test_pfespaces.at(i));
         // Apply all mixed kernels with this test/trial pair
@@ -378,12 +617,9 @@ EquationSystem::BuildMixedBilinearForms()
         mblf->Assemble();
         // Register mixed bilinear forms associated with a single trial variable
         // for the current test variable
-        test_mblfs->Register(trial_var_name, mblf);
+        test_mblfs.Register(trial_var_name, std::move(mblf));
       }
     }
-    // Register all mixed bilinear form sets associated with a single test
-    // variable
-    _mblfs.Register(test_var_name, test_mblfs);
   }
 }
 
@@ -410,16 +646,39 @@ TimeDependentEquationSystem::AddTrialVariableNameIfMissing(const std::string & v
   }
 }
 
+void
+TimeDependentEquationSystem::RegisterMissingGridFunctions(
+    hephaestus::GridFunctions & gridfunctions)
+{
+  // Time derivatives are only allocated for the trial variables of the equation system, once the
+  // kernels have declared them.
+  for (int i = 0; i < _trial_var_names.size(); i++)
+  {
+    const auto & time_derivative_name = _trial_var_time_derivative_names.at(i);
+    if (!gridfunctions.Has(time_derivative_name))
+    {
+      gridfunctions.Register(time_derivative_name,
+                             std::make_shared<mfem::ParGridFunction>(
+                                 gridfunctions.Get(_trial_var_names.at(i))->ParFESpace()));
+    }
+  }
+}
+
 void
 TimeDependentEquationSystem::SetTimeStep(double dt)
 {
   if (fabs(dt - _dt_coef.constant) > 1.0e-12 * dt)
   {
     _dt_coef.constant = dt;
-    for (auto test_var_name : _test_var_names)
+    for (auto blf_handle : _blf_handles)
     {
-      auto blf = _blfs.Get(test_var_name);
+      auto blf = _blfs.Get(blf_handle);
       blf->Update();
+      // Update discards the condensed system.
+      if (UsesStaticCondensation())
+      {
+        blf->EnableStaticCondensation();
+      }
       blf->Assemble();
     }
   }
@@ -3,7 +3,9 @@
 #include "inputs.hpp"
 #include "kernel_base.hpp"
 #include "named_fields_map.hpp"
+#include "scratch_pool.hpp"
 #include "sources.hpp"
+#include <tuple>
 
 namespace hephaestus
 {
@@ -78,6 +80,14 @@ public:
                                 mfem::BlockVector & trueX,
                                 mfem::BlockVector & trueRHS);
 
+  /// Rebuilds the linear forms and Dirichlet values, and forms the right-hand side of the linear
+  /// system in @a trueRHS against the bilinear forms assembled by the last FormLinearSystem, which
+  /// are not reassembled. Requires the assembled forms to be kept, so lean assembly and static
+  /// condensation must be disabled.
+  virtual void FormRightHandSide(hephaestus::BCMap & bc_map,
+                                 hephaestus::Sources & sources,
+                                 mfem::BlockVector & trueRHS);
+
   // Build linear system, with essential boundary conditions accounted for
   virtual void BuildJacobian(mfem::BlockVector & trueX, mfem::BlockVector & trueRHS);
 
@@ -93,15 +103,83 @@ public:
 
   std::vector<mfem::Array<int>> _ess_tdof_lists;
 
+  /// In lean assembly mode, the matrices held by the forms are freed as soon as the monolithic
+  /// operator has been formed, so only one copy of the operator persists. The forms must then be
+  /// rebuilt or reassembled before the linear system is formed again.
+  void SetLeanAssembly(bool lean_assembly) { _lean_assembly = lean_assembly; }
+  [[nodiscard]] bool UsesLeanAssembly() const { return _lean_assembly; }
+
+  /// Sets the pool from which per-step temporaries are taken. The pool must outlive the equation
+  /// system. By default, the equation system uses a pool of its own.
+  void SetScratchPool(hephaestus::ScratchPool & scratch) { _scratch = &scratch; }
+
+  /// With static condensation, the DOFs interior to elements are eliminated element by element as
+  /// the linear system is formed, and recovered locally in RecoverFEMSolution, so that the global
+  /// system is posed on the smaller trace space returned by GetSystemFESpace. It applies to
+  /// equation systems with a single test variable and no mixed bilinear forms, and must be set
+  /// before the Jacobian preconditioner is built.
+  void SetStaticCondensation(bool static_condensation);
+
+  /// Returns the FE space on which the linear system of test variable @a i is posed: the trace
+  /// space of its FE space if static condensation reduces it, and its FE space otherwise.
+  mfem::ParFiniteElementSpace * GetSystemFESpace(int i);
+
 protected:
+  // Registers gridfunctions that the equation system requires but that have not been provided.
+  // Called in Init, once the kernels have been added.
+  virtual void RegisterMissingGridFunctions(hephaestus::GridFunctions & gridfunctions) {}
+
   bool VectorContainsName(const std::vector<std::string> & the_vector,
                           const std::string & name) const;
 
   // gridfunctions for setting Dirichlet BCs
   std::vector<std::unique_ptr<mfem::ParGridFunction>> _xs;
 
+  // FE space sequence, BCMap revision and coefficient revision at which time-independent
+  // Dirichlet values were last projected into each of _xs. The projection is skipped while these
+  // are unchanged, so coefficients changed in place must be marked as modified.
+  std::vector<std::tuple<long, std::size_t, std::size_t>> _xs_projected_stamps;
+
+  // Coefficients the equation system was initialised with.
+  hephaestus::Coefficients * _coefficients{nullptr};
+
   mfem::Array2D<mfem::HypreParMatrix *> _h_blocks;
 
+  // Deletes the block references in _h_blocks.
+  void DeleteBlocks();
+
+  // Frees the assembled matrices of all bilinear and mixed bilinear forms.
+  void ReleaseAssembledForms();
+
+  bool _lean_assembly{false};
+
+  // Returns true if the interior DOFs of the test variable are condensed from its bilinear form.
+  [[nodiscard]] bool UsesStaticCondensation() const;
+
+  bool _static_condensation{false};
+
+  // Trace space of the test variable, built on request for preconditioners set up before the
+  // forms are assembled.
+  std::unique_ptr<mfem::FiniteElementCollection> _trace_fec{nullptr};
+  std::unique_ptr<mfem::ParFiniteElementSpace> _trace_fespace{nullptr};
+
+  // Block offsets of the condensed linear system, which trueX and trueRHS are resized to.
+  mfem::Array<int> _system_true_offsets;
+
+  hephaestus::ScratchPool & GetScratchPool() { return _scratch ? *_scratch : _local_scratch; }
+
+  hephaestus::ScratchPool * _scratch{nullptr};
+  hephaestus::ScratchPool _local_scratch;
+
+  // Handles to the weak form components of each test variable, resolved once in Init so that
+  // forms rebuilt each step are retrieved without string lookups.
+  std::vector<hephaestus::NamedFieldsMap<mfem::ParBilinearForm>::Handle> _blf_handles;
+  std::vector<hephaestus::NamedFieldsMap<mfem::ParLinearForm>::Handle> _lf_handles;
+  std::vector<hephaestus::NamedFieldsMap<mfem::ParMixedBilinearForm>::Handle> _mblf_test_handles;
+  // Indexed by (test variable, trial variable).
+  std::vector<std::vector<hephaestus::NamedFieldsMap<mfem::ParMixedBilinearForm>::Handle>>
+      _mblf_trial_handles;
+
   // Arrays to store kernels to act on each component of weak form. Named
   // according to test variable
   hephaestus::NamedFieldsMap<std::vector<std::shared_ptr<ParBilinearFormKernel>>> _blf_kernels_map;
@@ -137,6 +215,9 @@ public:
   virtual void UpdateEquationSystem(hephaestus::BCMap & bc_map, hephaestus::Sources & sources);
   mfem::ConstantCoefficient _dt_coef; // Coefficient for timestep scaling
   std::vector<std::string> _trial_var_time_derivative_names;
+
+protected:
+  void RegisterMissingGridFunctions(hephaestus::GridFunctions & gridfunctions) override;
 };
 
 } // namespace hephaestus
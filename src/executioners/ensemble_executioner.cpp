@@ -0,0 +1,140 @@
+#include "ensemble_executioner.hpp"
+
+namespace hephaestus
+{
+
+EnsembleExecutioner::EnsembleExecutioner(const hephaestus::InputParameters & params)
+  : Executioner(params),
+    _variants(params.GetParam<hephaestus::EnsembleVariants *>("Variants")),
+    _comm(params.GetOptionalParam<MPI_Comm>("Communicator", MPI_COMM_WORLD)),
+    _num_groups(params.GetOptionalParam<int>("NumGroups", 1)),
+    _results_file(params.GetOptionalParam<std::string>("ResultsFile", ""))
+{
+  int num_procs, myid;
+  MPI_Comm_size(_comm, &num_procs);
+  MPI_Comm_rank(_comm, &myid);
+
+  if (_num_groups < 1 || _num_groups > num_procs)
+  {
+    MFEM_ABORT("EnsembleExecutioner requires between 1 and " << num_procs << " groups.");
+  }
+
+  // Contiguous ranks share a group, so each group's mesh partition stays local.
+  _group = (myid * _num_groups) / num_procs;
+  MPI_Comm_split(_comm, _group, myid, &_group_comm);
+}
+
+EnsembleExecutioner::~EnsembleExecutioner()
+{
+  if (_group_comm != MPI_COMM_NULL)
+  {
+    MPI_Comm_free(&_group_comm);
+  }
+}
+
+void
+EnsembleExecutioner::Solve() const
+{
+  const int num_variants = _variants->NumVariants();
+  const int num_results = static_cast<int>(_variants->GetResultNames().size());
+
+  _results.SetSize(num_variants, num_results);
+  _results = 0.0;
+
+  if (_group >= num_variants)
+  {
+    return;
+  }
+
+  spdlog::stopwatch sw;
+
+  // Setup products of the problem are shared by all variants solved on this group.
+  auto problem = _variants->BuildProblem(_group_comm);
+
+  std::vector<double> results;
+  for (int variant = _group; variant < num_variants; variant += _num_groups)
+  {
+    _variants->SetVariant(variant, *problem);
+    // Variants modify coefficients in place, so operators and Dirichlet values cached from them
+    // must be rebuilt.
+    problem->_coefficients._scalars.MarkModified();
+    problem->_coefficients._vectors.MarkModified();
+
+    problem->_preprocessors.Solve();
+    problem->GetOperator()->Solve(*(problem->_f));
+    problem->_postprocessors.Solve();
+
+    results.assign(num_results, 0.0);
+    _variants->GetResults(variant, *problem, results);
+    for (int i = 0; i < num_results; ++i)
+    {
+      _results(variant, i) = results[i];
+    }
+  }
+
+  logger.info("{} group {} Solve: {} seconds", typeid(this).name(), _group, sw);
+}
+
+void
+EnsembleExecutioner::Execute() const
+{
+  Solve();
+  GatherResults();
+  WriteResults();
+}
+
+void
+EnsembleExecutioner::GatherResults() const
+{
+  // Only the root of each group contributes its rows, which no other group has filled.
+  int group_rank;
+  MPI_Comm_rank(_group_comm, &group_rank);
+  if (group_rank != 0)
+  {
+    _results = 0.0;
+  }
+
+  MPI_Allreduce(MPI_IN_PLACE,
+                _results.GetData(),
+                _results.Height() * _results.Width(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                _comm);
+}
+
+void
+EnsembleExecutioner::WriteResults() const
+{
+  int myid;
+  MPI_Comm_rank(_comm, &myid);
+  if (_results_file.empty() || myid != 0)
+  {
+    return;
+  }
+
+  std::ofstream results_file(_results_file);
+  if (!results_file)
+  {
+    MFEM_ABORT("Failed to open ensemble results file " << _results_file);
+  }
+
+  results_file << "variant";
+  for (const auto & name : _variants->GetResultNames())
+  {
+    results_file << "," << name;
+  }
+  results_file << "\n";
+
+  results_file.precision(16);
+  for (int variant = 0; variant < _results.Height(); ++variant)
+  {
+    results_file << variant;
+    for (int i = 0; i < _results.Width(); ++i)
+    {
+      results_file << "," << _results(variant, i);
+    }
+    results_file << "\n";
+  }
+}
+
+} // namespace hephaestus
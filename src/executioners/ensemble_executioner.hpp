@@ -0,0 +1,78 @@
+#pragma once
+#include "executioner_base.hpp"
+#include "steady_state_problem_builder.hpp"
+
+namespace hephaestus
+{
+
+/// Describes the variants of a steady problem solved by an @a EnsembleExecutioner.
+///
+/// Each group of ranks builds the problem once, so the mesh, its partition, FE spaces and
+/// material-independent source fields are shared by all variants solved on the group. Variants
+/// then differ only in what @a SetVariant changes, such as coefficient values or source amplitudes.
+class EnsembleVariants
+{
+public:
+  EnsembleVariants() = default;
+  virtual ~EnsembleVariants() = default;
+
+  /// Returns the number of variants in the ensemble.
+  [[nodiscard]] virtual int NumVariants() const = 0;
+
+  /// Returns the names of the scalar results reported for each variant.
+  [[nodiscard]] virtual std::vector<std::string> GetResultNames() const = 0;
+
+  /// Builds and finalises the problem on @a comm, which holds the ranks of one group.
+  virtual std::unique_ptr<hephaestus::SteadyStateProblem> BuildProblem(MPI_Comm comm) = 0;
+
+  /// Modifies @a problem to describe @a variant before it is solved. Coefficients may be changed in
+  /// place; the executioner marks them as modified afterwards.
+  virtual void SetVariant(int variant, hephaestus::SteadyStateProblem & problem) = 0;
+
+  /// Sets @a results to the scalar results of the solved @a variant, in the order of
+  /// @a GetResultNames. Called on every rank of the group.
+  virtual void GetResults(int variant,
+                          hephaestus::SteadyStateProblem & problem,
+                          std::vector<double> & results) = 0;
+};
+
+/// Runs a parameter sweep by splitting the communicator into "NumGroups" groups of ranks. Each
+/// group solves every "NumGroups"-th variant of the "Variants" ensemble, and the results of all
+/// variants are gathered into a single table, optionally written to "ResultsFile" as CSV.
+class EnsembleExecutioner : public Executioner
+{
+public:
+  EnsembleExecutioner() = default;
+  explicit EnsembleExecutioner(const hephaestus::InputParameters & params);
+
+  ~EnsembleExecutioner() override;
+
+  // Solve the variants assigned to this rank's group
+  void Solve() const override;
+
+  // Solve all variants and gather the results table
+  void Execute() const override;
+
+  /// Returns the results table, with one row per variant and one column per result name. Valid on
+  /// all ranks after @a Execute.
+  [[nodiscard]] const mfem::DenseMatrix & GetResults() const { return _results; }
+
+  /// Returns the index of this rank's group.
+  [[nodiscard]] int GetGroup() const { return _group; }
+
+private:
+  void GatherResults() const;
+  void WriteResults() const;
+
+  hephaestus::EnsembleVariants * _variants{nullptr};
+  MPI_Comm _comm;
+  int _num_groups;
+  std::string _results_file;
+
+  int _group;
+  MPI_Comm _group_comm{MPI_COMM_NULL};
+
+  mutable mfem::DenseMatrix _results;
+};
+
+} // namespace hephaestus
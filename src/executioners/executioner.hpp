@@ -1,3 +1,5 @@
 #pragma once
+#include "ensemble_executioner.hpp"
+#include "solve_service.hpp"
 #include "steady_executioner.hpp"
 #include "transient_executioner.hpp"
@@ -0,0 +1,376 @@
+#include "solve_service.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <sstream>
+#include <thread>
+
+namespace hephaestus
+{
+
+namespace
+{
+
+// Returns a UNIX socket address for path.
+sockaddr_un
+SocketAddress(const std::string & path)
+{
+  sockaddr_un address{};
+  if (path.size() >= sizeof(address.sun_path))
+  {
+    MFEM_ABORT("Socket path " << path << " is too long.");
+  }
+
+  address.sun_family = AF_UNIX;
+  path.copy(address.sun_path, path.size());
+  return address;
+}
+
+// Reads the next newline-terminated line from fd, keeping any further data in buffer. Returns
+// false if the connection is closed first.
+bool
+ReadLine(int fd, std::string & buffer, std::string & line)
+{
+  char chunk[4096];
+  std::size_t end;
+  while ((end = buffer.find('\n')) == std::string::npos)
+  {
+    const ssize_t count = read(fd, chunk, sizeof(chunk));
+    if (count <= 0)
+    {
+      return false;
+    }
+    buffer.append(chunk, count);
+  }
+
+  line = buffer.substr(0, end);
+  buffer.erase(0, end + 1);
+  return true;
+}
+
+// Writes the whole message to fd. Returns false if the connection is closed first, which is
+// reported as EPIPE while SIGPIPE is ignored.
+bool
+WriteAll(int fd, const std::string & message)
+{
+  std::size_t written = 0;
+  while (written < message.size())
+  {
+    const ssize_t count = write(fd, message.data() + written, message.size() - written);
+    if (count < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (count <= 0)
+    {
+      return false;
+    }
+    written += count;
+  }
+
+  return true;
+}
+
+} // namespace
+
+SolveServiceExecutioner::SolveServiceExecutioner(const hephaestus::InputParameters & params)
+  : Executioner(params),
+    _problem(params.GetParam<hephaestus::SteadyStateProblem *>("Problem")),
+    _socket_path(params.GetOptionalParam<std::string>("SocketPath", "hephaestus.sock"))
+{
+}
+
+void
+SolveServiceExecutioner::Solve() const
+{
+  spdlog::stopwatch sw;
+
+  _problem->_preprocessors.Solve();
+  _problem->GetOperator()->Solve(*(_problem->_f));
+  _problem->_postprocessors.Solve();
+
+  logger.info("{} Solve: {} seconds", typeid(this).name(), sw);
+}
+
+void
+SolveServiceExecutioner::Execute() const
+{
+  _shutdown = false;
+
+  if (_problem->_myid == 0)
+  {
+    ServeRoot();
+  }
+  else
+  {
+    ServeNonRoot();
+  }
+}
+
+std::string
+SolveServiceExecutioner::HandleRequest(const std::string & request) const
+{
+  std::istringstream tokens(request);
+  std::ostringstream reply;
+  reply.precision(16);
+  reply << "OK";
+
+  std::string command;
+  while (tokens >> command)
+  {
+    if (command == "SET" || command == "SET_SOURCE")
+    {
+      std::string name;
+      double value;
+      if (!(tokens >> name >> value))
+      {
+        return "ERROR " + command + " requires a coefficient name and a value";
+      }
+
+      auto * coef = FindConstantCoefficient(name);
+      if (coef == nullptr)
+      {
+        return "ERROR " + name + " is not a constant scalar coefficient";
+      }
+
+      coef->constant = value;
+
+      // Operators cached from the coefficients, and coefficients derived from them, are rebuilt
+      // on the next solve.
+      if (command == "SET")
+      {
+        _problem->_coefficients._scalars.MarkModified();
+      }
+    }
+    else if (command == "SOLVE")
+    {
+      Solve();
+    }
+    else if (command == "FLUX")
+    {
+      std::string name;
+      tokens >> name;
+
+      auto & postprocessors = _problem->_postprocessors;
+      auto * monitor = postprocessors.Has(name)
+                           ? dynamic_cast<hephaestus::FluxMonitorAux *>(postprocessors.Get(name))
+                           : nullptr;
+      if (monitor == nullptr || monitor->_fluxes.Size() == 0)
+      {
+        return "ERROR " + name + " is not a flux monitor with a computed flux";
+      }
+
+      reply << " FLUX:" << name << "=" << monitor->_fluxes.Last();
+    }
+    else if (command == "NORM" || command == "SAVE")
+    {
+      std::string name;
+      tokens >> name;
+
+      if (!_problem->_gridfunctions.Has(name))
+      {
+        return "ERROR " + name + " is not a gridfunction";
+      }
+      mfem::ParGridFunction & gf = *_problem->_gridfunctions.Get(name);
+
+      if (command == "NORM")
+      {
+        mfem::Vector true_dofs(gf.ParFESpace()->GetTrueVSize());
+        gf.ParallelProject(true_dofs);
+
+        reply << " NORM:" << name << "="
+              << mfem::ParNormlp(true_dofs, 2, gf.ParFESpace()->GetComm());
+      }
+      else
+      {
+        std::string prefix;
+        if (!(tokens >> prefix))
+        {
+          return "ERROR SAVE requires a gridfunction name and a file prefix";
+        }
+
+        std::ofstream field_file(mfem::MakeParFilename(prefix + ".", _problem->_myid));
+        field_file.precision(16);
+        gf.Save(field_file);
+
+        reply << " SAVE:" << name << "=" << prefix;
+      }
+    }
+    else if (command == "SHUTDOWN")
+    {
+      _shutdown = true;
+    }
+    else
+    {
+      return "ERROR unknown command " + command;
+    }
+  }
+
+  return reply.str();
+}
+
+mfem::ConstantCoefficient *
+SolveServiceExecutioner::FindConstantCoefficient(const std::string & name) const
+{
+  auto & coefficients = _problem->_coefficients;
+  if (coefficients._scalars.Has(name))
+  {
+    return dynamic_cast<mfem::ConstantCoefficient *>(coefficients._scalars.Get(name));
+  }
+
+  // Subdomain values, from which piecewise global coefficients such as materials are built.
+  const std::size_t separator = name.find('.');
+  if (separator == std::string::npos)
+  {
+    return nullptr;
+  }
+
+  const std::string subdomain_name = name.substr(0, separator);
+  const std::string coef_name = name.substr(separator + 1);
+  for (auto & subdomain : coefficients._subdomains)
+  {
+    if (subdomain._name == subdomain_name && subdomain._scalar_coefficients.Has(coef_name))
+    {
+      return dynamic_cast<mfem::ConstantCoefficient *>(
+          subdomain._scalar_coefficients.Get(coef_name));
+    }
+  }
+
+  return nullptr;
+}
+
+void
+SolveServiceExecutioner::ServeRoot() const
+{
+  const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  const sockaddr_un address = SocketAddress(_socket_path);
+
+  unlink(_socket_path.c_str());
+  if (server < 0 || bind(server, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) ||
+      listen(server, 1))
+  {
+    MFEM_ABORT("Failed to listen on socket " << _socket_path);
+  }
+
+  logger.info("Solve service listening on {}", _socket_path);
+
+  // A client that disconnects before reading its reply must not stop the service, and with it the
+  // ranks waiting for the next request. Failed writes then close the connection instead.
+  auto * const previous_handler = std::signal(SIGPIPE, SIG_IGN);
+
+  while (!_shutdown)
+  {
+    const int connection = accept(server, nullptr, nullptr);
+    if (connection < 0)
+    {
+      continue;
+    }
+
+    std::string buffer, request;
+    while (!_shutdown && ReadLine(connection, buffer, request))
+    {
+      int length = static_cast<int>(request.size());
+      BroadcastRequest(length, request);
+
+      if (!WriteAll(connection, HandleRequest(request) + "\n"))
+      {
+        break;
+      }
+    }
+
+    close(connection);
+  }
+
+  int stop = -1;
+  std::string none;
+  BroadcastRequest(stop, none);
+
+  close(server);
+  unlink(_socket_path.c_str());
+  std::signal(SIGPIPE, previous_handler);
+}
+
+void
+SolveServiceExecutioner::ServeNonRoot() const
+{
+  std::string request;
+  int length;
+  while (true)
+  {
+    BroadcastRequest(length, request);
+    if (length < 0)
+    {
+      break;
+    }
+
+    HandleRequest(request);
+  }
+}
+
+void
+SolveServiceExecutioner::BroadcastRequest(int & length, std::string & request) const
+{
+  // No communication is needed when the problem is solved on one rank.
+  if (_problem->_num_procs == 1)
+  {
+    return;
+  }
+
+  MPI_Bcast(&length, 1, MPI_INT, 0, _problem->_comm);
+  if (length > 0)
+  {
+    request.resize(length);
+    MPI_Bcast(request.data(), length, MPI_CHAR, 0, _problem->_comm);
+  }
+  else
+  {
+    request.clear();
+  }
+}
+
+SolveServiceClient::SolveServiceClient(const std::string & socket_path, int max_attempts)
+{
+  const sockaddr_un address = SocketAddress(socket_path);
+
+  for (int attempt = 0; attempt < max_attempts; ++attempt)
+  {
+    _socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (connect(_socket, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0)
+    {
+      return;
+    }
+
+    close(_socket);
+    _socket = -1;
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  MFEM_ABORT("Failed to connect to solve service on " << socket_path);
+}
+
+SolveServiceClient::~SolveServiceClient()
+{
+  if (_socket >= 0)
+  {
+    close(_socket);
+  }
+}
+
+std::string
+SolveServiceClient::Request(const std::string & request)
+{
+  std::string reply;
+  if (!WriteAll(_socket, request + "\n") || !ReadLine(_socket, _buffer, reply))
+  {
+    MFEM_ABORT("Lost connection to solve service.");
+  }
+
+  return reply;
+}
+
+} // namespace hephaestus
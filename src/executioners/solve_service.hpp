@@ -0,0 +1,81 @@
+#pragma once
+#include "executioner_base.hpp"
+#include "steady_state_problem_builder.hpp"
+
+namespace hephaestus
+{
+
+/// Long-running service that solves a steady problem, built once, for a sequence of requests
+/// received over a local UNIX socket. The mesh, FE spaces, sources and cached operators persist
+/// between requests, so each request only pays for what it changes.
+///
+/// A request is a single line of space-separated commands, executed in order:
+///   SET <name> <value>            Sets a constant scalar coefficient used by the operator, such
+///                                 as the frequency. <subdomain>.<name> sets the value of a
+///                                 coefficient on a subdomain, such as a material property.
+///   SET_SOURCE <name> <value>     Sets a constant scalar coefficient used only by sources, such
+///                                 as a coil current, which leaves cached operators valid. Accepts
+///                                 subdomain values in the same form as SET.
+///   SOLVE                         Solves the problem.
+///   FLUX <postprocessor>          Returns the latest flux of a FluxMonitorAux postprocessor.
+///   NORM <gridfunction>           Returns the l2 norm of the true DOFs of a gridfunction.
+///   SAVE <gridfunction> <prefix>  Writes each rank's part of a gridfunction to <prefix>.<rank>.
+///   SHUTDOWN                      Stops the service after replying.
+/// The reply is a single line: "OK", followed by "<COMMAND>:<name>=<value>" for each returned
+/// result, or "ERROR <message>" if a command failed, in which case the later commands are skipped.
+class SolveServiceExecutioner : public Executioner
+{
+public:
+  SolveServiceExecutioner() = default;
+  explicit SolveServiceExecutioner(const hephaestus::InputParameters & params);
+
+  ~SolveServiceExecutioner() override = default;
+
+  // Solve the problem with its current coefficients and sources
+  void Solve() const override;
+
+  // Serve requests on the socket until a SHUTDOWN request is received
+  void Execute() const override;
+
+  /// Executes a request and returns the reply. Must be called with the same request on every rank
+  /// of the problem communicator.
+  std::string HandleRequest(const std::string & request) const;
+
+private:
+  // Accepts connections and reads requests on the root rank, sharing each with the other ranks.
+  void ServeRoot() const;
+
+  // Executes the requests shared by the root rank until the service stops.
+  void ServeNonRoot() const;
+
+  // Returns the constant scalar coefficient called name, or for a name of the form
+  // <subdomain>.<coefficient>, the coefficient of that subdomain. Returns nullptr if there is none.
+  mfem::ConstantCoefficient * FindConstantCoefficient(const std::string & name) const;
+
+  // Shares the length of a request, or -1 to stop, followed by the request itself.
+  void BroadcastRequest(int & length, std::string & request) const;
+
+  hephaestus::SteadyStateProblem * _problem{nullptr};
+  std::string _socket_path;
+
+  mutable bool _shutdown{false};
+};
+
+/// Client stub for a @a SolveServiceExecutioner, sending requests over its UNIX socket.
+class SolveServiceClient
+{
+public:
+  /// Connects to the service, retrying for up to @a max_attempts times while it starts up.
+  explicit SolveServiceClient(const std::string & socket_path, int max_attempts = 100);
+
+  ~SolveServiceClient();
+
+  /// Sends a request and waits for its reply.
+  std::string Request(const std::string & request);
+
+private:
+  int _socket{-1};
+  std::string _buffer;
+};
+
+} // namespace hephaestus
@@ -19,6 +19,8 @@ SteadyExecutioner::Solve() const
   // Output data
   // Output timestep summary to console
   _problem->_outputs.Write();
+
+  _problem->_scratch.LogStatistics(typeid(this).name());
 }
 
 void
@@ -3,6 +3,39 @@
 namespace hephaestus
 {
 
+namespace
+{
+
+// Writes the field of source to target, on the same mesh.
+void
+TransferGridFunction(mfem::ParGridFunction & source, mfem::ParGridFunction & target)
+{
+  if (source.ParFESpace() == target.ParFESpace())
+  {
+    target = source;
+    return;
+  }
+  // Projection evaluates the source on the elements of the target, so both must be defined on
+  // the same mesh object.
+  if (source.ParFESpace()->GetParMesh() != target.ParFESpace()->GetParMesh())
+  {
+    MFEM_ABORT("Cannot transfer a gridfunction between different meshes.");
+  }
+
+  if (source.VectorDim() > 1)
+  {
+    mfem::VectorGridFunctionCoefficient source_coef(&source);
+    target.ProjectCoefficient(source_coef);
+  }
+  else
+  {
+    mfem::GridFunctionCoefficient source_coef(&source);
+    target.ProjectCoefficient(source_coef);
+  }
+}
+
+} // namespace
+
 TransientExecutioner::TransientExecutioner(const hephaestus::InputParameters & params)
   : Executioner(params),
     _problem(params.GetParam<hephaestus::TimeDomainProblem *>("Problem")),
@@ -12,8 +45,21 @@ TransientExecutioner::TransientExecutioner(const hephaestus::InputParameters & p
     _t(_t_initial),
     _it(0),
     _vis_steps(params.GetOptionalParam<int>("VisualisationSteps", 1)),
-    _last_step(false)
+    _last_step(false),
+    _harmonic_problem(params.GetOptionalParam<hephaestus::SteadyStateProblem *>(
+        "HarmonicStartProblem", nullptr)),
+    _harmonic_variable_names(params.GetOptionalParam<std::vector<std::string>>(
+        "HarmonicStartVariableNames", {})),
+    _harmonic_real_names(
+        params.GetOptionalParam<std::vector<std::string>>("HarmonicStartRealNames", {})),
+    _harmonic_imag_names(
+        params.GetOptionalParam<std::vector<std::string>>("HarmonicStartImagNames", {}))
 {
+  if (_harmonic_real_names.size() != _harmonic_variable_names.size() ||
+      _harmonic_imag_names.size() != _harmonic_variable_names.size())
+  {
+    MFEM_ABORT("Harmonic start requires a real and an imaginary part for each variable.");
+  }
 }
 
 void
@@ -51,10 +97,56 @@ TransientExecutioner::Execute() const
   _t = _t_initial;
   _last_step = false;
   _it = 0;
+  ApplyHarmonicStart();
   while (_last_step != true)
   {
     Solve();
   }
+
+  _problem->_scratch.LogStatistics(typeid(this).name());
+}
+
+void
+TransientExecutioner::ApplyHarmonicStart() const
+{
+  if (_harmonic_problem == nullptr)
+  {
+    return;
+  }
+  spdlog::stopwatch sw;
+
+  _harmonic_problem->_preprocessors.Solve();
+  _harmonic_problem->GetOperator()->Solve(*(_harmonic_problem->_f));
+  _harmonic_problem->_postprocessors.Solve();
+
+  // Registered by the frequency-domain formulations.
+  if (!_harmonic_problem->_coefficients._scalars.Has("_angular_frequency"))
+  {
+    MFEM_ABORT("Harmonic start requires a frequency-domain problem.");
+  }
+  const double omega =
+      _harmonic_problem->_coefficients._scalars.Get<mfem::ConstantCoefficient>("_angular_frequency")
+          ->constant;
+  const double cos_phase = cos(omega * _t_initial);
+  const double sin_phase = sin(omega * _t_initial);
+
+  for (std::size_t i = 0; i < _harmonic_variable_names.size(); ++i)
+  {
+    auto * variable = _problem->_gridfunctions.Get(_harmonic_variable_names.at(i));
+
+    mfem::ParGridFunction real_part(variable->ParFESpace()), imag_part(variable->ParFESpace());
+    TransferGridFunction(*_harmonic_problem->_gridfunctions.Get(_harmonic_real_names.at(i)),
+                         real_part);
+    TransferGridFunction(*_harmonic_problem->_gridfunctions.Get(_harmonic_imag_names.at(i)),
+                         imag_part);
+
+    // u = Re(û exp(iωt)). The variable is a view into the state, so it is written in place. The
+    // time derivative is not set, as the implicit solve of the first step discards it.
+    variable->Set(cos_phase, real_part);
+    variable->Add(-sin_phase, imag_part);
+  }
+
+  logger.info("{} ApplyHarmonicStart: {} seconds", typeid(this).name(), sw);
 }
 
 } // namespace hephaestus
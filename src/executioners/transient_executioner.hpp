@@ -1,5 +1,6 @@
 #pragma once
 #include "executioner_base.hpp"
+#include "steady_state_problem_builder.hpp"
 #include "time_domain_problem_builder.hpp"
 
 namespace hephaestus
@@ -21,6 +22,15 @@ public:
 
   void Execute() const override;
 
+  /// Solves the frequency-domain problem given by "HarmonicStartProblem", and sets each variable
+  /// of "HarmonicStartVariableNames" to the field Re(û exp(iωt)) at the start time, where û has
+  /// the real and imaginary parts named in "HarmonicStartRealNames" and "HarmonicStartImagNames".
+  /// The transient then starts near its periodic steady state rather than from rest. Time
+  /// derivatives are left unchanged: the implicit solve of each step computes them afresh, so an
+  /// initial rate would be discarded. Both problems must share the ParMesh object. Called by
+  /// @a Execute; does nothing if no frequency-domain problem is given.
+  void ApplyHarmonicStart() const;
+
 private:
   double _t_initial;       // Start time
   double _t_final;         // End time
@@ -29,6 +39,12 @@ private:
   int _vis_steps;          // Number of cyces between each output update
   mutable bool _last_step; // Flag to check if current step is final
   hephaestus::TimeDomainProblem * _problem{nullptr};
+
+  // Frequency-domain problem and the names of its solution fields, to start from.
+  hephaestus::SteadyStateProblem * _harmonic_problem{nullptr};
+  std::vector<std::string> _harmonic_variable_names;
+  std::vector<std::string> _harmonic_real_names;
+  std::vector<std::string> _harmonic_imag_names;
 };
 
 } // namespace hephaestus
@@ -5,6 +5,30 @@
 namespace hephaestus
 {
 
+namespace
+{
+
+// Sets the constant coefficients derived from the angular frequency omega. Returns true if any of
+// them has changed.
+bool
+SetAngularFrequency(hephaestus::Coefficients & coefficients, double omega)
+{
+  auto & scalars = coefficients._scalars;
+  auto * angular_frequency = scalars.Get<mfem::ConstantCoefficient>("_angular_frequency");
+  if (angular_frequency->constant == omega)
+  {
+    return false;
+  }
+
+  angular_frequency->constant = omega;
+  scalars.Get<mfem::ConstantCoefficient>("_neg_angular_frequency")->constant = -omega;
+  scalars.Get<mfem::ConstantCoefficient>("_angular_frequency_sq")->constant = omega * omega;
+  scalars.Get<mfem::ConstantCoefficient>("_neg_angular_frequency_sq")->constant = -omega * omega;
+  return true;
+}
+
+} // namespace
+
 ComplexMaxwellFormulation::ComplexMaxwellFormulation(std::string alpha_coef_name,
                                                      std::string beta_coef_name,
                                                      std::string zeta_coef_name,
@@ -39,7 +63,8 @@ ComplexMaxwellFormulation::ConstructOperator()
                                                                            _h_curl_var_imag_name,
                                                                            _alpha_coef_name,
                                                                            _mass_coef_name,
-                                                                           _loss_coef_name);
+                                                                           _loss_coef_name,
+                                                                           _frequency_coef_name);
 
   GetProblem()->SetOperator(std::move(new_operator));
 }
@@ -89,19 +114,16 @@ ComplexMaxwellFormulation::RegisterCoefficients()
 
   _freq_coef = coefficients._scalars.Get<mfem::ConstantCoefficient>(_frequency_coef_name);
 
-  // define transformed
-  coefficients._scalars.Register(
-      "_angular_frequency",
-      std::make_shared<mfem::ConstantCoefficient>(2.0 * M_PI * _freq_coef->constant));
-  coefficients._scalars.Register(
-      "_neg_angular_frequency",
-      std::make_shared<mfem::ConstantCoefficient>(-2.0 * M_PI * _freq_coef->constant));
-  coefficients._scalars.Register(
-      "_angular_frequency_sq",
-      std::make_shared<mfem::ConstantCoefficient>(pow(2.0 * M_PI * _freq_coef->constant, 2)));
-  coefficients._scalars.Register(
-      "_neg_angular_frequency_sq",
-      std::make_shared<mfem::ConstantCoefficient>(-pow(2.0 * M_PI * _freq_coef->constant, 2)));
+  // define transformed. The constants derived from the frequency are refreshed by the operator
+  // before each solve, as the frequency may be changed in place.
+  for (const auto * name : {"_angular_frequency",
+                            "_neg_angular_frequency",
+                            "_angular_frequency_sq",
+                            "_neg_angular_frequency_sq"})
+  {
+    coefficients._scalars.Register(name, std::make_shared<mfem::ConstantCoefficient>(0.0));
+  }
+  SetAngularFrequency(coefficients, 2.0 * M_PI * _freq_coef->constant);
 
   coefficients._scalars.Register("_inv_angular_frequency",
                                  std::make_shared<mfem::RatioCoefficient>(
@@ -119,6 +141,9 @@ ComplexMaxwellFormulation::RegisterCoefficients()
                                      coefficients._scalars.Get(_beta_coef_name),
                                      prodFunc));
 
+  // The loss term vanishes wherever the conductivity does.
+  coefficients.ShareSupport(_loss_coef_name, _beta_coef_name);
+
   coefficients._scalars.Register(
       _alpha_coef_name,
       std::make_shared<mfem::TransformedCoefficient>(
@@ -131,14 +156,16 @@ ComplexMaxwellOperator::ComplexMaxwellOperator(hephaestus::Problem & problem,
                                                std::string h_curl_var_imag_name,
                                                std::string stiffness_coef_name,
                                                std::string mass_coef_name,
-                                               std::string loss_coef_name)
+                                               std::string loss_coef_name,
+                                               std::string frequency_coef_name)
   : ProblemOperator(problem),
     _h_curl_var_complex_name(std::move(h_curl_var_complex_name)),
     _h_curl_var_real_name(std::move(h_curl_var_real_name)),
     _h_curl_var_imag_name(std::move(h_curl_var_imag_name)),
     _stiffness_coef_name(std::move(stiffness_coef_name)),
     _mass_coef_name(std::move(mass_coef_name)),
-    _loss_coef_name(std::move(loss_coef_name))
+    _loss_coef_name(std::move(loss_coef_name)),
+    _frequency_coef_name(std::move(frequency_coef_name))
 {
 }
 
@@ -165,6 +192,9 @@ ComplexMaxwellOperator::Init(mfem::Vector & X)
     _mass_coef = _problem._coefficients._scalars.Get(_mass_coef_name);
   if (_problem._coefficients._scalars.Has(_loss_coef_name))
     _loss_coef = _problem._coefficients._scalars.Get(_loss_coef_name);
+
+  _freq_coef =
+      _problem._coefficients._scalars.Get<mfem::ConstantCoefficient>(_frequency_coef_name);
 }
 
 void
@@ -178,23 +208,41 @@ ComplexMaxwellOperator::Solve(mfem::Vector & X)
   zero_vec = 0.0;
   mfem::VectorConstantCoefficient zero_coef(zero_vec);
 
+  // The coefficients derived from the frequency are copied from it, so they are refreshed in case
+  // the frequency has been changed in place since the last solve.
+  if (SetAngularFrequency(_problem._coefficients, 2.0 * M_PI * _freq_coef->constant))
+  {
+    _problem._coefficients._scalars.MarkModified();
+  }
+
   mfem::ParSesquilinearForm sqlf(_u->ParFESpace(), _conv);
   sqlf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(*_stiff_coef), nullptr);
   if (_mass_coef)
   {
     sqlf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_mass_coef), nullptr);
   }
-  if (_loss_coef)
+  // The support is looked up on each solve, as the conductivity may have changed in place.
+  _restrict_loss = _problem._coefficients.GetSupportMarkers(
+      _loss_coef_name, *_problem._pmesh, _loss_markers);
+  if (_loss_coef && _restrict_loss)
+  {
+    sqlf.AddDomainIntegrator(nullptr, new mfem::VectorFEMassIntegrator(*_loss_coef), _loss_markers);
+  }
+  else if (_loss_coef)
   {
     sqlf.AddDomainIntegrator(nullptr, new mfem::VectorFEMassIntegrator(*_loss_coef));
   }
 
-  mfem::ParLinearForm lf_real(_u->ParFESpace());
-  mfem::ParLinearForm lf_imag(_u->ParFESpace());
+  auto * fespace = _u->ParFESpace();
+  auto & scratch = _problem._scratch;
+  mfem::ParLinearForm lf_real(
+      fespace, scratch.GetVector("ComplexMaxwellOperator::lf_real", fespace->GetVSize()).GetData());
+  mfem::ParLinearForm lf_imag(
+      fespace, scratch.GetVector("ComplexMaxwellOperator::lf_imag", fespace->GetVSize()).GetData());
   lf_real = 0.0;
   lf_imag = 0.0;
 
-  _problem._sources.Apply(&lf_real);
+  ApplySources(lf_real);
 
   mfem::ParComplexLinearForm lf(_u->ParFESpace(), _conv);
   _problem._bc_map.ApplyEssentialBCs(
@@ -211,14 +259,138 @@ ComplexMaxwellOperator::Solve(mfem::Vector & X)
 
   sqlf.FormLinearSystem(_ess_bdr_tdofs, *_u, lf, jac, u, rhs);
 
-  auto * jac_z = jac.As<mfem::ComplexHypreParMatrix>()->GetSystemMatrix();
+  _system_matrix.reset(jac.As<mfem::ComplexHypreParMatrix>()->GetSystemMatrix());
 
-  _problem._jacobian_solver->SetOperator(*jac_z);
+  _problem._jacobian_solver->SetOperator(*_system_matrix);
   _problem._jacobian_solver->Mult(rhs, u);
-  sqlf.RecoverFEMSolution(u, lf, *_u);
+  // The real and imaginary trial variables are adjacent views into the state vector, laid out as
+  // a complex gridfunction, so the solution is recovered into them directly. _u only has to hold
+  // the essential boundary values.
+  auto * real = _trial_variables.at(0);
+  auto * imag = _trial_variables.at(1);
+  if (imag->GetData() == real->GetData() + real->Size())
+  {
+    mfem::Vector u_state(real->GetData(), real->Size() + imag->Size());
+    sqlf.RecoverFEMSolution(u, lf, u_state);
+  }
+  else
+  {
+    sqlf.RecoverFEMSolution(u, lf, *_u);
+    *real = _u->real();
+    *imag = _u->imag();
+  }
+}
+
+void
+ComplexMaxwellOperator::SolveAdjoint(hephaestus::AdjointObjective & objective,
+                                     hephaestus::AdjointSensitivities & sensitivities)
+{
+  if (!_system_matrix)
+  {
+    MFEM_ABORT("ComplexMaxwellOperator::Solve must be called before SolveAdjoint.");
+  }
+
+  spdlog::stopwatch sw;
+
+  auto * fespace = _u->ParFESpace();
+  const int true_vsize = fespace->GetTrueVSize();
+  auto & scratch = _problem._scratch;
+
+  RecordSourceLoads(*fespace);
+
+  objective.Init(_problem._gridfunctions, _problem._coefficients);
+  sensitivities = hephaestus::AdjointSensitivities();
+  sensitivities._objective = objective.Evaluate();
+
+  // Adjoint right-hand side dJ/du for the real and imaginary parts, with homogeneous essential
+  // BCs.
+  mfem::ParLinearForm gradient_real(
+      fespace, scratch.GetVector("ComplexMaxwellOperator::lf_real", fespace->GetVSize()).GetData());
+  mfem::ParLinearForm gradient_imag(
+      fespace, scratch.GetVector("ComplexMaxwellOperator::lf_imag", fespace->GetVSize()).GetData());
+  gradient_real = 0.0;
+  gradient_imag = 0.0;
+  objective.AddGradient(_h_curl_var_real_name, gradient_real);
+  objective.AddGradient(_h_curl_var_imag_name, gradient_imag);
+
+  mfem::Vector & rhs =
+      scratch.GetVector("ComplexMaxwellOperator::adjoint_rhs", 2 * true_vsize);
+  mfem::Vector & lambda =
+      scratch.GetVector("ComplexMaxwellOperator::adjoint_sol", 2 * true_vsize);
+  mfem::Vector rhs_real(rhs, 0, true_vsize), rhs_imag(rhs, true_vsize, true_vsize);
+  mfem::Vector lambda_real(lambda, 0, true_vsize), lambda_imag(lambda, true_vsize, true_vsize);
+
+  gradient_real.ParallelAssemble(rhs_real);
+  gradient_imag.ParallelAssemble(rhs_imag);
+  rhs_real.SetSubVector(_ess_bdr_tdofs, 0.0);
+  rhs_imag.SetSubVector(_ess_bdr_tdofs, 0.0);
+
+  // With the Hermitian convention the system matrix M = [A_r, -A_i; A_i, A_r] satisfies
+  // Mᵀ = S M S with S = diag(I, -I), so Mᵀ λ = g is solved with the forward solver as
+  // M (S λ) = S g. With the block symmetric convention M is symmetric.
+  const bool hermitian = (_conv == mfem::ComplexOperator::HERMITIAN);
+  if (hermitian)
+  {
+    rhs_imag.Neg();
+  }
+
+  lambda = 0.0;
+  _problem._jacobian_solver->Mult(rhs, lambda);
+
+  if (hermitian)
+  {
+    lambda_imag.Neg();
+  }
+
+  mfem::ParGridFunction lambda_real_gf(fespace), lambda_imag_gf(fespace);
+  lambda_real_gf.Distribute(lambda_real);
+  lambda_imag_gf.Distribute(lambda_imag);
+
+  const auto & u_real = *_trial_variables.at(0);
+  const auto & u_imag = *_trial_variables.at(1);
+  const auto & subdomains = _problem._coefficients._subdomains;
+
+  // dJ/dp = -λᵀ (∂M/∂p) u. The imaginary rows of M are negated under the block symmetric
+  // convention.
+  const double imag_sign = hermitian ? 1.0 : -1.0;
+
+  // Stiffness and mass coefficients enter A_r.
+  mfem::CurlCurlIntegrator unit_curl_curl;
+  auto & stiffness_sensitivities = sensitivities._coefficients[_stiffness_coef_name];
+  hephaestus::AddSubdomainProducts(
+      unit_curl_curl, lambda_real_gf, u_real, -1.0, subdomains, stiffness_sensitivities);
+  hephaestus::AddSubdomainProducts(
+      unit_curl_curl, lambda_imag_gf, u_imag, -imag_sign, subdomains, stiffness_sensitivities);
+
+  mfem::VectorFEMassIntegrator unit_mass;
+  if (_mass_coef)
+  {
+    auto & mass_sensitivities = sensitivities._coefficients[_mass_coef_name];
+    hephaestus::AddSubdomainProducts(
+        unit_mass, lambda_real_gf, u_real, -1.0, subdomains, mass_sensitivities);
+    hephaestus::AddSubdomainProducts(
+        unit_mass, lambda_imag_gf, u_imag, -imag_sign, subdomains, mass_sensitivities);
+  }
+
+  // The loss coefficient enters A_i.
+  if (_loss_coef)
+  {
+    auto & loss_sensitivities = sensitivities._coefficients[_loss_coef_name];
+    hephaestus::AddSubdomainProducts(
+        unit_mass, lambda_real_gf, u_imag, 1.0, subdomains, loss_sensitivities);
+    hephaestus::AddSubdomainProducts(
+        unit_mass, lambda_imag_gf, u_real, -imag_sign, subdomains, loss_sensitivities);
+  }
+
+  // dJ/ds_c = λᵀ b_c, where the load vector b_c of source c is real and kept from the forward
+  // solve.
+  for (const auto & [source_name, load] : _source_loads)
+  {
+    sensitivities._sources[source_name] =
+        mfem::InnerProduct(fespace->GetComm(), lambda_real, *load);
+  }
 
-  _problem._gridfunctions.GetRef(_trial_var_names.at(0)) = _u->real();
-  _problem._gridfunctions.GetRef(_trial_var_names.at(1)) = _u->imag();
+  logger.info("{} SolveAdjoint: {} seconds", typeid(this).name(), sw);
 }
 
 } // namespace hephaestus
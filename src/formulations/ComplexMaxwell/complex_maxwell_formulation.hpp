@@ -68,7 +68,8 @@ public:
                          std::string h_curl_var_imag_name,
                          std::string stiffness_coef_name,
                          std::string mass_coef_name,
-                         std::string loss_coef_name);
+                         std::string loss_coef_name,
+                         std::string frequency_coef_name);
 
   ~ComplexMaxwellOperator() override = default;
 
@@ -76,8 +77,13 @@ public:
   void Init(mfem::Vector & X) override;
   void Solve(mfem::Vector & X) override;
 
+  /// Solves the adjoint system with the system matrix and solver of the last solve. Sensitivities
+  /// are found for the stiffness, mass and loss coefficients on each subdomain and for each source.
+  void SolveAdjoint(hephaestus::AdjointObjective & objective,
+                    hephaestus::AdjointSensitivities & sensitivities) override;
+
   std::string _h_curl_var_complex_name, _h_curl_var_real_name, _h_curl_var_imag_name,
-      _stiffness_coef_name, _mass_coef_name, _loss_coef_name;
+      _stiffness_coef_name, _mass_coef_name, _loss_coef_name, _frequency_coef_name;
 
   mfem::ComplexOperator::Convention _conv{mfem::ComplexOperator::HERMITIAN};
 
@@ -85,8 +91,16 @@ public:
   mfem::Coefficient * _stiff_coef{nullptr}; // Dia/Paramagnetic Material Coefficient
   mfem::Coefficient * _mass_coef{nullptr};  // -omega^2 epsilon
   mfem::Coefficient * _loss_coef{nullptr};  // omega sigma
+  mfem::ConstantCoefficient * _freq_coef{nullptr};
+
+  // Attributes on which the loss coefficient is non-zero, used to restrict its assembly.
+  mfem::Array<int> _loss_markers;
+  bool _restrict_loss{false};
 
   mfem::Array<int> _ess_bdr_tdofs;
+
+  // Real block form of the system matrix of the last solve, kept for adjoint solves.
+  std::unique_ptr<mfem::HypreParMatrix> _system_matrix{nullptr};
 };
 
 } // namespace hephaestus
@@ -61,13 +61,18 @@ DualFormulation::DualFormulation(std::string alpha_coef_name,
 void
 DualFormulation::ConstructJacobianPreconditioner()
 {
-  auto precond =
-      std::make_shared<mfem::HypreAMS>(GetProblem()->GetEquationSystem()->_test_pfespaces.at(0));
-
-  precond->SetSingularProblem();
-  precond->SetPrintLevel(-1);
-
-  GetProblem()->_jacobian_preconditioner = precond;
+  auto * equation_system = GetProblem()->GetEquationSystem();
+  auto * edge_fespace = equation_system->GetSystemFESpace(0);
+
+  // a1(u, u') = (βu, u') + (αdt∇×u, ∇×u')
+  hephaestus::HCurlMaterialCoefficients materials;
+  materials._alpha = GetProblem()->_coefficients._scalars.Get("dt_" + _alpha_coef_name);
+  materials._beta = GetProblem()->_coefficients._scalars.Get(_beta_coef_name);
+  materials._ess_bdr = GetProblem()->_bc_map.GetEssentialBdrMarkers(
+      equation_system->_test_var_names.at(0), edge_fespace->GetParMesh());
+
+  GetProblem()->_jacobian_preconditioner = hephaestus::CreateHCurlPreconditioner(
+      GetProblem()->_solver_options, edge_fespace, materials);
 }
 
 void
@@ -63,6 +63,9 @@ public:
   void ImplicitSolve(const double dt, const mfem::Vector & X, mfem::Vector & dX_dt) override;
   void SetGridFunctions() override;
 
+  /// Returns the discrete curl from the H(curl) to the H(div) space.
+  [[nodiscard]] mfem::ParDiscreteLinearOperator & GetCurl() const { return *_curl; }
+
   mfem::ParFiniteElementSpace * _h_curl_fe_space{nullptr};
   mfem::ParFiniteElementSpace * _h_div_fe_space{nullptr};
 
@@ -40,13 +40,16 @@ StaticsFormulation::StaticsFormulation(std::string alpha_coef_name, std::string
 void
 StaticsFormulation::ConstructJacobianPreconditioner()
 {
-  std::shared_ptr<mfem::HypreAMS> precond{std::make_shared<mfem::HypreAMS>(
-      GetProblem()->_gridfunctions.Get(_h_curl_var_name)->ParFESpace())};
+  auto * edge_fespace = GetProblem()->_gridfunctions.Get(_h_curl_var_name)->ParFESpace();
 
-  precond->SetSingularProblem();
-  precond->SetPrintLevel(-1);
+  // a1(u, u') = (α∇×u, ∇×u'); singular, so no β term.
+  hephaestus::HCurlMaterialCoefficients materials;
+  materials._alpha = GetProblem()->_coefficients._scalars.Get(_alpha_coef_name);
+  materials._ess_bdr =
+      GetProblem()->_bc_map.GetEssentialBdrMarkers(_h_curl_var_name, edge_fespace->GetParMesh());
 
-  GetProblem()->_jacobian_preconditioner = precond;
+  GetProblem()->_jacobian_preconditioner = hephaestus::CreateHCurlPreconditioner(
+      GetProblem()->_solver_options, edge_fespace, materials);
 }
 
 void
@@ -116,6 +119,99 @@ StaticsOperator::Init(mfem::Vector & X)
 {
   ProblemOperator::Init(X);
   _stiff_coef = _problem._coefficients._scalars.Get(_stiffness_coef_name);
+
+  if (_problem._mesh_hierarchy.size() > 1 &&
+      _problem._solver_options.GetOptionalParam<bool>("NestedIteration", true))
+  {
+    _nested_iteration = std::make_unique<hephaestus::HCurlNestedIteration>(
+        _problem._solver_options, _problem._mesh_hierarchy, _trial_variables.at(0)->ParFESpace());
+
+    // The fine solve starts from the nested iteration guess.
+    _problem._jacobian_solver->iterative_mode = true;
+  }
+}
+
+bool
+StaticsOperator::OperatorIsOutOfDate() const
+{
+  const auto * fespace = _trial_variables.at(0)->ParFESpace();
+
+  return _operator_out_of_date || !_blf || _fespace_sequence != fespace->GetSequence() ||
+         _bc_revision != _problem._bc_map.GetRevision() ||
+         _coefficients_revision != _problem._coefficients._scalars.GetRevision();
+}
+
+void
+StaticsOperator::BuildOperator()
+{
+  spdlog::stopwatch sw;
+
+  auto * fespace = _trial_variables.at(0)->ParFESpace();
+  _stiff_coef = _problem._coefficients._scalars.Get(_stiffness_coef_name);
+
+  // a1(u, u') = (α∇×u, ∇×u')
+  _blf = std::make_unique<mfem::ParBilinearForm>(fespace);
+  _blf->AddDomainIntegrator(new mfem::CurlCurlIntegrator(*_stiff_coef));
+  _blf->Assemble();
+  _blf->Finalize();
+
+  _problem._bc_map.GetEssentialTrueDofs(
+      _h_curl_var_name, _ess_bdr_tdofs, *fespace, _problem._pmesh.get());
+  _blf->FormSystemMatrix(_ess_bdr_tdofs, _curl_mu_inv_curl);
+
+  // Sets up the preconditioner (AMS), which is then shared by all solves until the next rebuild.
+  _problem._jacobian_solver->SetOperator(_curl_mu_inv_curl);
+
+  if (_nested_iteration)
+  {
+    _nested_iteration->SetOperator(
+        _curl_mu_inv_curl,
+        _problem._bc_map.GetEssentialBdrMarkers(_h_curl_var_name, _problem._pmesh.get()));
+  }
+
+  _fespace_sequence = fespace->GetSequence();
+  _bc_revision = _problem._bc_map.GetRevision();
+  _coefficients_revision = _problem._coefficients._scalars.GetRevision();
+  _operator_out_of_date = false;
+
+  logger.info("{} BuildOperator: {} seconds", typeid(this).name(), sw);
+}
+
+void
+StaticsOperator::FormSystem(hephaestus::Sources & sources,
+                            mfem::ParGridFunction & gf,
+                            mfem::Vector & sol_tdofs,
+                            mfem::Vector & rhs_tdofs)
+{
+  // b1(u') = (s0, u') + <(α∇×u) × n, u'>
+  auto * fespace = gf.ParFESpace();
+  auto & scratch = _problem._scratch;
+  mfem::ParLinearForm lf(fespace,
+                         scratch.GetVector("StaticsOperator::lf", fespace->GetVSize()).GetData());
+  lf = 0.0;
+  gf = 0.0;
+  mfem::Array<int> ess_bdr_tdofs;
+  _problem._bc_map.ApplyEssentialBCs(_h_curl_var_name, ess_bdr_tdofs, gf, _problem._pmesh.get());
+  _problem._bc_map.ApplyIntegratedBCs(_h_curl_var_name, lf, _problem._pmesh.get());
+  lf.Assemble();
+  if (&sources == &_problem._sources)
+  {
+    ApplySources(lf);
+  }
+  else
+  {
+    sources.Apply(&lf);
+  }
+
+  // Equivalent to the right-hand side of ParBilinearForm::FormLinearSystem, using the eliminated
+  // part of the operator kept by _blf.
+  MFEM_ASSERT(sol_tdofs.Size() == fespace->GetTrueVSize() &&
+                  rhs_tdofs.Size() == fespace->GetTrueVSize(),
+              "True DOF vectors must be sized to the FE space.");
+  lf.ParallelAssemble(rhs_tdofs);
+  gf.ParallelProject(sol_tdofs);
+  _blf->EliminateVDofsInRHS(_ess_bdr_tdofs, sol_tdofs, rhs_tdofs);
+  sol_tdofs.SetSubVectorComplement(_ess_bdr_tdofs, 0.0);
 }
 
 /*
@@ -133,31 +229,134 @@ StaticsOperator::Solve(mfem::Vector & X)
 {
   spdlog::stopwatch sw;
 
+  if (OperatorIsOutOfDate())
+  {
+    BuildOperator();
+  }
+
   mfem::ParGridFunction & gf(*_trial_variables.at(0));
-  gf = 0.0;
-  mfem::ParLinearForm lf(gf.ParFESpace());
-  lf = 0.0;
-  mfem::Array<int> ess_bdr_tdofs;
-  _problem._bc_map.ApplyEssentialBCs(_h_curl_var_name, ess_bdr_tdofs, gf, _problem._pmesh.get());
-  _problem._bc_map.ApplyIntegratedBCs(_h_curl_var_name, lf, _problem._pmesh.get());
-  lf.Assemble();
-  _problem._sources.Apply(&lf);
-  mfem::ParBilinearForm blf(gf.ParFESpace());
-  blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(*_stiff_coef));
-  blf.Assemble();
-  blf.Finalize();
-  mfem::HypreParMatrix curl_mu_inv_curl;
-  mfem::HypreParVector sol_tdofs(gf.ParFESpace());
-  mfem::HypreParVector rhs_tdofs(gf.ParFESpace());
-  blf.FormLinearSystem(ess_bdr_tdofs, gf, lf, curl_mu_inv_curl, sol_tdofs, rhs_tdofs);
-
-  // Define and apply a parallel FGMRES solver for AX=B with the AMS
-  // preconditioner from hypre.
-  _problem._jacobian_solver->SetOperator(curl_mu_inv_curl);
+  const int true_vsize = gf.ParFESpace()->GetTrueVSize();
+  auto & scratch = _problem._scratch;
+  auto & sol_tdofs = scratch.GetVector("StaticsOperator::sol_tdofs", true_vsize);
+  auto & rhs_tdofs = scratch.GetVector("StaticsOperator::rhs_tdofs", true_vsize);
+  FormSystem(_problem._sources, gf, sol_tdofs, rhs_tdofs);
+
+  if (_nested_iteration)
+  {
+    _nested_iteration->Mult(rhs_tdofs, sol_tdofs);
+  }
+
+  // Apply the parallel FGMRES solver, with the AMS preconditioner set up in BuildOperator.
   _problem._jacobian_solver->Mult(rhs_tdofs, sol_tdofs);
-  blf.RecoverFEMSolution(sol_tdofs, lf, gf);
+  gf.Distribute(sol_tdofs);
 
   logger.info("{} Solve: {} seconds", typeid(this).name(), sw);
 }
 
+void
+StaticsOperator::SolveLoadCases(const std::vector<hephaestus::Sources *> & load_cases,
+                                const std::vector<mfem::ParGridFunction *> & solutions)
+{
+  if (load_cases.size() != solutions.size())
+  {
+    MFEM_ABORT("StaticsOperator::SolveLoadCases requires one solution gridfunction per load case.");
+  }
+
+  spdlog::stopwatch sw;
+
+  if (OperatorIsOutOfDate())
+  {
+    BuildOperator();
+  }
+
+  // Form all right-hand sides first, then solve them against the shared operator and
+  // preconditioner.
+  const int true_vsize = _trial_variables.at(0)->ParFESpace()->GetTrueVSize();
+  const int num_cases = static_cast<int>(load_cases.size());
+  mfem::Vector & sol_block =
+      _problem._scratch.GetVector("StaticsOperator::sol_block", num_cases * true_vsize);
+  mfem::Vector & rhs_block =
+      _problem._scratch.GetVector("StaticsOperator::rhs_block", num_cases * true_vsize);
+
+  for (int i = 0; i < num_cases; i++)
+  {
+    mfem::Vector sol_tdofs(sol_block, i * true_vsize, true_vsize);
+    mfem::Vector rhs_tdofs(rhs_block, i * true_vsize, true_vsize);
+    FormSystem(*load_cases.at(i), *solutions.at(i), sol_tdofs, rhs_tdofs);
+  }
+
+  for (int i = 0; i < num_cases; i++)
+  {
+    mfem::Vector sol_tdofs(sol_block, i * true_vsize, true_vsize);
+    mfem::Vector rhs_tdofs(rhs_block, i * true_vsize, true_vsize);
+    if (_nested_iteration)
+    {
+      _nested_iteration->Mult(rhs_tdofs, sol_tdofs);
+    }
+    _problem._jacobian_solver->Mult(rhs_tdofs, sol_tdofs);
+    solutions.at(i)->Distribute(sol_tdofs);
+  }
+
+  logger.info("{} SolveLoadCases: {} load cases in {} seconds", typeid(this).name(), num_cases, sw);
+}
+
+void
+StaticsOperator::SolveAdjoint(hephaestus::AdjointObjective & objective,
+                              hephaestus::AdjointSensitivities & sensitivities)
+{
+  if (OperatorIsOutOfDate())
+  {
+    MFEM_ABORT("StaticsOperator::Solve must be called before SolveAdjoint.");
+  }
+
+  spdlog::stopwatch sw;
+
+  mfem::ParGridFunction & gf(*_trial_variables.at(0));
+  auto * fespace = gf.ParFESpace();
+  auto & scratch = _problem._scratch;
+
+  RecordSourceLoads(*fespace);
+
+  objective.Init(_problem._gridfunctions, _problem._coefficients);
+  sensitivities = hephaestus::AdjointSensitivities();
+  sensitivities._objective = objective.Evaluate();
+
+  // Adjoint right-hand side dJ/du, with homogeneous essential BCs.
+  mfem::ParLinearForm gradient(
+      fespace, scratch.GetVector("StaticsOperator::lf", fespace->GetVSize()).GetData());
+  gradient = 0.0;
+  objective.AddGradient(_h_curl_var_name, gradient);
+
+  auto & rhs_tdofs = scratch.GetVector("StaticsOperator::rhs_tdofs", fespace->GetTrueVSize());
+  auto & sol_tdofs = scratch.GetVector("StaticsOperator::sol_tdofs", fespace->GetTrueVSize());
+  gradient.ParallelAssemble(rhs_tdofs);
+  rhs_tdofs.SetSubVector(_ess_bdr_tdofs, 0.0);
+
+  // The curl-curl operator is symmetric, so the adjoint reuses the forward solver.
+  sol_tdofs = 0.0;
+  _problem._jacobian_solver->Mult(rhs_tdofs, sol_tdofs);
+
+  mfem::ParGridFunction lambda(fespace);
+  lambda.Distribute(sol_tdofs);
+
+  // dJ/dα_s = -λᵀ (∂K/∂α_s) u, where ∂K/∂α_s is the curl-curl matrix on subdomain s.
+  mfem::CurlCurlIntegrator unit_curl_curl;
+  hephaestus::AddSubdomainProducts(unit_curl_curl,
+                                   lambda,
+                                   gf,
+                                   -1.0,
+                                   _problem._coefficients._subdomains,
+                                   sensitivities._coefficients[_stiffness_coef_name]);
+
+  // dJ/ds_c = λᵀ b_c, where b_c is the load vector of source c kept from the forward solve, so
+  // that sources are not applied again.
+  for (const auto & [source_name, load] : _source_loads)
+  {
+    sensitivities._sources[source_name] =
+        mfem::InnerProduct(fespace->GetComm(), sol_tdofs, *load);
+  }
+
+  logger.info("{} SolveAdjoint: {} seconds", typeid(this).name(), sw);
+}
+
 } // namespace hephaestus
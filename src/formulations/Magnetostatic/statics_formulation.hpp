@@ -2,6 +2,7 @@
 #include "../common/pfem_extras.hpp"
 #include "formulation.hpp"
 #include "inputs.hpp"
+#include "nested_iteration.hpp"
 #include "sources.hpp"
 
 namespace hephaestus
@@ -40,12 +41,56 @@ public:
 
   void SetGridFunctions() override;
   void Init(mfem::Vector & X) override;
+
+  /// Solves for the problem's sources. The assembled operator and preconditioner are kept between
+  /// solves, and rebuilt only when the coefficients, BCs or FE space change. If the problem has a
+  /// mesh hierarchy, the initial guess is found by nested iteration on the coarser meshes.
   void Solve(mfem::Vector & X) override;
 
+  /// Solves for each set of sources in load_cases, writing the results into solutions. All load
+  /// cases share the essential and integrated BCs, the operator and the preconditioner. The
+  /// sources must have been initialised.
+  void SolveLoadCases(const std::vector<hephaestus::Sources *> & load_cases,
+                      const std::vector<mfem::ParGridFunction *> & solutions);
+
+  /// Solves the adjoint system with the operator and preconditioner of the last solve, which are
+  /// symmetric. Sensitivities are found for the stiffness coefficient on each subdomain and for
+  /// each source.
+  void SolveAdjoint(hephaestus::AdjointObjective & objective,
+                    hephaestus::AdjointSensitivities & sensitivities) override;
+
+  /// Forces the operator to be rebuilt on the next solve, e.g. after a coefficient has been
+  /// modified in place.
+  void MarkOperatorOutOfDate() { _operator_out_of_date = true; }
+
 private:
+  [[nodiscard]] bool OperatorIsOutOfDate() const;
+
+  // Assembles the operator, eliminates essential DOFs and sets up the solver.
+  void BuildOperator();
+
+  // Forms the true DOF solution guess and right-hand side for the given sources, with essential
+  // BCs projected into gf. Both vectors must already be sized to the true DOFs of gf. The
+  // problem's own sources are applied with ApplySources.
+  void FormSystem(hephaestus::Sources & sources,
+                  mfem::ParGridFunction & gf,
+                  mfem::Vector & sol_tdofs,
+                  mfem::Vector & rhs_tdofs);
+
   std::string _h_curl_var_name, _stiffness_coef_name;
 
   mfem::Coefficient * _stiff_coef{nullptr}; // Stiffness Material Coefficient
+
+  std::unique_ptr<mfem::ParBilinearForm> _blf{nullptr};
+  std::unique_ptr<hephaestus::HCurlNestedIteration> _nested_iteration{nullptr};
+  mfem::HypreParMatrix _curl_mu_inv_curl;
+  mfem::Array<int> _ess_bdr_tdofs;
+
+  // State of the problem when the operator was last built.
+  bool _operator_out_of_date{true};
+  long _fespace_sequence{-1};
+  std::size_t _bc_revision{0};
+  std::size_t _coefficients_revision{0};
 };
 
 } // namespace hephaestus
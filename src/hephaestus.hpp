@@ -1,8 +1,11 @@
 #pragma once
 #include "../common/pfem_extras.hpp"
+#include "ensemble_executioner.hpp"
 #include "factory.hpp"
 #include "inputs.hpp"
+#include "pod_rom.hpp"
 #include "problem_builder.hpp"
+#include "solve_service.hpp"
 #include "steady_executioner.hpp"
 #include "transient_executioner.hpp"
 #include "utils.hpp"
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "boundary_conditions.hpp"
@@ -12,6 +13,37 @@
 namespace hephaestus
 {
 
+/// Converts a stored arithmetic value of any type to T. Returns false if T or the stored value is
+/// not arithmetic.
+template <typename T>
+bool
+ConvertArithmeticParam(const std::any & value, T & result)
+{
+  if constexpr (std::is_arithmetic_v<T>)
+  {
+    if (const auto * stored = std::any_cast<double>(&value))
+      result = static_cast<T>(*stored);
+    else if (const auto * stored = std::any_cast<float>(&value))
+      result = static_cast<T>(*stored);
+    else if (const auto * stored = std::any_cast<int>(&value))
+      result = static_cast<T>(*stored);
+    else if (const auto * stored = std::any_cast<unsigned int>(&value))
+      result = static_cast<T>(*stored);
+    else if (const auto * stored = std::any_cast<long>(&value))
+      result = static_cast<T>(*stored);
+    else if (const auto * stored = std::any_cast<unsigned long>(&value))
+      result = static_cast<T>(*stored);
+    else
+      return false;
+
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
 class InputParameters
 {
 
@@ -22,35 +54,82 @@ public:
   InputParameters() = default;
   InputParameters(std::map<std::string, std::any> _params) : _params(std::move(_params)) {}
   void SetParam(std::string param_name, std::any value) { _params[param_name] = value; };
+
+  /// Predicate to check if a parameter has been set.
+  [[nodiscard]] bool Has(const std::string & param_name) const
+  {
+    return _params.find(param_name) != _params.end();
+  }
+
+  /// Returns a pointer to the stored value of a parameter, or nullptr if it has not been set.
+  [[nodiscard]] const std::any * Find(const std::string & param_name) const
+  {
+    auto it = _params.find(param_name);
+    return (it != _params.end()) ? &it->second : nullptr;
+  }
+
+  template <typename T>
+  [[nodiscard]] T GetParam(const std::string & param_name) const
+  {
+    const std::any * value = Find(param_name);
+    if (!value)
+    {
+      MFEM_ABORT("Required parameter '" << param_name << "' has not been set.");
+    }
+
+    const T * param = std::any_cast<T>(value);
+    if (!param)
+    {
+      MFEM_ABORT("Required parameter '" << param_name << "' has type '" << value->type().name()
+                                        << "', expected '" << typeid(T).name() << "'.");
+    }
+    return *param;
+  };
+
+  /// Returns the value of a parameter, or @a value if it has not been set. A parameter set with a
+  /// different type is ignored with a warning; use a ParameterSchema to reject it instead.
   template <typename T>
-  [[nodiscard]] [[nodiscard]] T GetParam(std::string param_name) const
+  [[nodiscard]] T GetOptionalParam(const std::string & param_name, T value) const
   {
-    T param;
-    try
+    const std::any * stored = Find(param_name);
+    if (!stored)
     {
-      param = std::any_cast<T>(_params.at(param_name));
+      return value;
     }
-    catch (const std::exception & e)
+
+    const T * param = std::any_cast<T>(stored);
+    if (!param)
     {
-      MFEM_ABORT("Exception raised when trying to cast required parameter '" << param_name
-                                                                             << "': " << e.what());
+      logger.warn("Ignoring parameter '{}' of type '{}', expected '{}'.",
+                  param_name,
+                  stored->type().name(),
+                  typeid(T).name());
+      return value;
     }
-    return param;
+    return *param;
   };
+
+  /// Returns the value of an arithmetic parameter converted to T, or @a value if it has not been
+  /// set. A value of any arithmetic type is accepted, so that a tolerance may be given as a float
+  /// or a double. A non-arithmetic value is ignored with a warning.
   template <typename T>
-  [[nodiscard]] [[nodiscard]] [[nodiscard]] T GetOptionalParam(std::string param_name,
-                                                               T value) const
+  [[nodiscard]] T GetOptionalNumericParam(const std::string & param_name, T value) const
   {
-    T param;
-    try
+    const std::any * stored = Find(param_name);
+    if (!stored)
     {
-      param = std::any_cast<T>(_params.at(param_name));
+      return value;
     }
-    catch (...)
+
+    T result{};
+    if (!ConvertArithmeticParam(*stored, result))
     {
-      param = value;
+      logger.warn("Ignoring parameter '{}' of type '{}', expected a number.",
+                  param_name,
+                  stored->type().name());
+      return value;
     }
-    return param;
+    return result;
   };
 };
 
@@ -91,6 +91,14 @@ private:
   void SetGridFunctions(hephaestus::GridFunctions & gridfunctions)
   {
     _gridfunctions = &gridfunctions;
+
+    // Synchronise over the ranks sharing the mesh, which may be a subset of the world.
+    if (_gridfunctions->begin() != _gridfunctions->end())
+    {
+      _my_comm = _gridfunctions->begin()->second->ParFESpace()->GetComm();
+      MPI_Comm_size(_my_comm, &_n_ranks);
+      MPI_Comm_rank(_my_comm, &_my_rank);
+    }
   }
 
   // Register fields (gridfunctions) to write to DataCollections
@@ -0,0 +1,108 @@
+#pragma once
+#include <any>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "inputs.hpp"
+
+namespace hephaestus
+{
+
+/// Typed description of the parameters read by a class into a parameter struct.
+///
+/// Each entry binds a parameter name to a member of ParamsStruct. The defaults are the values in
+/// the struct passed to Parse, so a class declares its defaults once, in the struct. Parse
+/// validates the parameters and copies them into the struct. After that, reading a parameter is a
+/// field access. A parameter set with the wrong type aborts, rather than being silently replaced by
+/// its default. Arithmetic parameters accept any arithmetic type and convert it, so "Tolerance" may
+/// be given as a float or a double.
+///
+/// Schemas are normally built once, as a function-local static:
+///
+///   static const auto schema = ParameterSchema<MyParams>()
+///                                  .Optional("Tolerance", &MyParams::_tolerance)
+///                                  .Required("VariableName", &MyParams::_variable_name);
+template <typename ParamsStruct>
+class ParameterSchema
+{
+public:
+  ParameterSchema() = default;
+
+  /// Declares a parameter that keeps the struct's value if it has not been set.
+  template <typename T>
+  ParameterSchema & Optional(std::string name, T ParamsStruct::*member)
+  {
+    _entries.push_back(std::make_shared<Entry<T>>(std::move(name), member, false));
+    return *this;
+  }
+
+  /// Declares a parameter that must be set.
+  template <typename T>
+  ParameterSchema & Required(std::string name, T ParamsStruct::*member)
+  {
+    _entries.push_back(std::make_shared<Entry<T>>(std::move(name), member, true));
+    return *this;
+  }
+
+  /// Returns @a values with all parameters set in @a params copied into it.
+  [[nodiscard]] ParamsStruct Parse(const hephaestus::InputParameters & params,
+                                   ParamsStruct values = ParamsStruct()) const
+  {
+    for (const auto & entry : _entries)
+    {
+      entry->Read(params, values);
+    }
+    return values;
+  }
+
+private:
+  class EntryBase
+  {
+  public:
+    virtual ~EntryBase() = default;
+    virtual void Read(const hephaestus::InputParameters & params, ParamsStruct & values) const = 0;
+  };
+
+  template <typename T>
+  class Entry : public EntryBase
+  {
+  public:
+    Entry(std::string name, T ParamsStruct::*member, bool required)
+      : _name(std::move(name)), _member(member), _required(required)
+    {
+    }
+
+    void Read(const hephaestus::InputParameters & params, ParamsStruct & values) const override
+    {
+      const std::any * value = params.Find(_name);
+      if (!value)
+      {
+        if (_required)
+        {
+          MFEM_ABORT("Required parameter '" << _name << "' has not been set.");
+        }
+        return;
+      }
+
+      if (const T * typed = std::any_cast<T>(value))
+      {
+        values.*_member = *typed;
+      }
+      else if (!ConvertArithmeticParam(*value, values.*_member))
+      {
+        MFEM_ABORT("Parameter '" << _name << "' has type '" << value->type().name()
+                                 << "', expected '" << typeid(T).name() << "'.");
+      }
+    }
+
+  private:
+    std::string _name;
+    T ParamsStruct::*_member;
+    bool _required;
+  };
+
+  std::vector<std::shared_ptr<const EntryBase>> _entries;
+};
+
+} // namespace hephaestus
@@ -6,6 +6,12 @@ namespace hephaestus
 VectorFEMassKernel::VectorFEMassKernel(const hephaestus::InputParameters & params)
   : Kernel(params), _coef_name(params.GetParam<std::string>("CoefficientName"))
 {
+  if (params.Has("SubdomainAttributes"))
+  {
+    _support = params.GetParam<mfem::Array<int>>("SubdomainAttributes");
+    _has_support = true;
+    _fixed_support = true;
+  }
 }
 
 void
@@ -15,12 +21,27 @@ VectorFEMassKernel::Init(hephaestus::GridFunctions & gridfunctions,
                          hephaestus::Coefficients & coefficients)
 {
   _coef = coefficients._scalars.Get(_coef_name);
+  _coefficients = &coefficients;
 }
 
 void
 VectorFEMassKernel::Apply(mfem::ParBilinearForm * blf)
 {
-  blf->AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_coef));
+  // Skip elements where β vanishes, e.g. conductivity in air. The recorded support is looked up
+  // on each assembly, as β may have changed in place.
+  if (!_fixed_support)
+  {
+    _has_support = _coefficients->GetSupport(_coef_name, _support);
+  }
+  auto * pmesh = blf->ParFESpace()->GetParMesh();
+  if (_has_support && SupportMarkers(_support, *pmesh, _subdomain_markers))
+  {
+    blf->AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_coef), _subdomain_markers);
+  }
+  else
+  {
+    blf->AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_coef));
+  }
 };
 
 } // namespace hephaestus
@@ -6,6 +6,9 @@ namespace hephaestus
 
 /*
 (βu, u')
+
+Assembled only over the attributes given by the optional "SubdomainAttributes" parameter or,
+failing that, over the recorded support of β.
 */
 class VectorFEMassKernel : public Kernel<mfem::ParBilinearForm>
 {
@@ -21,6 +24,14 @@ public:
   void Apply(mfem::ParBilinearForm * blf) override;
   std::string _coef_name;
   mfem::Coefficient * _coef{nullptr};
+
+  hephaestus::Coefficients * _coefficients{nullptr};
+
+  bool _has_support{false};
+  // True if the support is given by the "SubdomainAttributes" parameter.
+  bool _fixed_support{false};
+  mfem::Array<int> _support;
+  mfem::Array<int> _subdomain_markers;
 };
 
 } // namespace hephaestus
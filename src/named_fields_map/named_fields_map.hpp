@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <map>
 #include <set>
 #include <string>
@@ -9,13 +10,20 @@
 namespace hephaestus
 {
 
-/// Lightweight adaptor over an std::map from strings to pointer to T
+/// Lightweight adaptor over an std::map from strings to pointer to T.
+///
+/// Names used in hot paths can be resolved once with GetHandle to an integer handle. Fields are
+/// then retrieved with an index into a flat vector, avoiding the string comparisons of a map lookup
+/// and the reference count updates of copying a shared pointer. A handle remains valid, and refers
+/// to the same name, for the lifetime of the map: re-registering a field under the same name
+/// updates the slot the handle points to.
 template <typename T>
 class NamedFieldsMap
 {
 public:
   using MapType = std::map<std::string, std::shared_ptr<T>>;
   using const_iterator = typename MapType::const_iterator;
+  using Handle = std::size_t;
 
   /// Default initializer.
   NamedFieldsMap() = default;
@@ -37,11 +45,98 @@ public:
 
     Deregister(field_name);
 
+    _slots[GetHandle(field_name)] = field.get();
     _field_map[field_name] = std::move(field);
+    ++_revision;
   }
 
   /// Unregister association between a field and the field_name.
-  void Deregister(const std::string & field_name) { _field_map.erase(field_name); }
+  void Deregister(const std::string & field_name)
+  {
+    if (_field_map.erase(field_name))
+    {
+      ++_revision;
+    }
+
+    auto it = _handles.find(field_name);
+    if (it != _handles.end())
+    {
+      _slots[it->second] = nullptr;
+    }
+  }
+
+  /// Records that a registered field has been modified in place, so that data derived from the
+  /// registered fields is treated as out of date.
+  void MarkModified() { ++_revision; }
+
+  /// Returns the handle for field_name, creating one if the name has not been seen before. The
+  /// field need not be registered yet; it must be registered before it is retrieved by handle.
+  [[nodiscard]] Handle GetHandle(const std::string & field_name)
+  {
+    auto [it, inserted] = _handles.emplace(field_name, _slots.size());
+    if (inserted)
+    {
+      _slots.push_back(nullptr);
+      _handle_names.push_back(field_name);
+    }
+
+    return it->second;
+  }
+
+  /// Returns handles for all supplied keys.
+  [[nodiscard]] std::vector<Handle> GetHandles(const std::vector<std::string> & keys)
+  {
+    std::vector<Handle> handles;
+    handles.reserve(keys.size());
+
+    for (const auto & key : keys)
+    {
+      handles.push_back(GetHandle(key));
+    }
+
+    return handles;
+  }
+
+  /// Predicate to check if a field is registered under the name of the handle.
+  [[nodiscard]] inline bool Has(Handle handle) const
+  {
+    return handle < _slots.size() && _slots[handle] != nullptr;
+  }
+
+  /// Returns a non-owning pointer to the field with the handle. This is guaranteed to return a
+  /// non-null pointer.
+  [[nodiscard]] inline T * Get(Handle handle) const
+  {
+    if (!Has(handle))
+    {
+      MFEM_ABORT("The field '" << (handle < _handle_names.size() ? _handle_names[handle] : "")
+                               << "' has not been registered.");
+    }
+
+    return _slots[handle];
+  }
+
+  /// Returns a reference to the field with the handle.
+  [[nodiscard]] inline T & GetRef(Handle handle) const { return *Get(handle); }
+
+  /// Returns a non-owning pointer to the field with the handle, where TDerived is a derived class
+  /// of class T.
+  template <typename TDerived>
+  [[nodiscard]] inline TDerived * Get(Handle handle) const
+  {
+    return EnsurePointerCastIsNonNull<TDerived>(Get(handle));
+  }
+
+  /// Returns a counter that changes whenever a field is registered, deregistered or marked as
+  /// modified. Data derived from the registered fields can store it to detect when it is out of
+  /// date.
+  [[nodiscard]] inline std::size_t GetRevision() const { return _revision; }
+
+  /// Returns the name associated with a handle.
+  [[nodiscard]] inline const std::string & GetName(Handle handle) const
+  {
+    return _handle_names.at(handle);
+  }
 
   /// Predicate to check if a field is registered with name field_name.
   [[nodiscard]] inline bool Has(const std::string & field_name) const
@@ -52,23 +147,19 @@ public:
   /// Returns a shared pointer to the field. This is guaranteed to return a non-null shared pointer.
   [[nodiscard]] inline std::shared_ptr<T> GetShared(const std::string & field_name) const
   {
-    CheckFieldIsRegistered(field_name);
-
-    auto it = FindField(field_name);
-
-    return EnsureFieldPointerIsNonNull(it);
+    return EnsureFieldPointerIsNonNull(FindRegisteredField(field_name));
   }
 
   /// Returns a reference to a field.
   [[nodiscard]] inline T & GetRef(const std::string & field_name) const
   {
-    return *GetShared(field_name);
+    return *Get(field_name);
   }
 
   /// Returns a non-owning pointer to the field. This is guaranteed to return a non-null pointer.
   [[nodiscard]] inline T * Get(const std::string & field_name) const
   {
-    return GetShared(field_name).get();
+    return EnsureFieldPointerIsNonNull(FindRegisteredField(field_name)).get();
   }
 
   /// Returns a non-owning pointer to the field where TDerived is a derived class of class T.
@@ -84,13 +175,13 @@ public:
   [[nodiscard]] std::vector<T *> Get(const std::vector<std::string> & keys) const
   {
     std::vector<T *> values;
+    values.reserve(keys.size());
 
     for (const auto & key : keys)
     {
       values.push_back(Get(key));
     }
 
-    values.shrink_to_fit();
     return values;
   }
 
@@ -109,6 +200,19 @@ protected:
     return _field_map.find(field_name);
   }
 
+  /// Returns a const iterator to the field, which must be registered.
+  [[nodiscard]] inline const_iterator FindRegisteredField(const std::string & field_name) const
+  {
+    auto it = FindField(field_name);
+
+    if (it == end())
+    {
+      MFEM_ABORT("The field '" << field_name << "' has not been registered.");
+    }
+
+    return it;
+  }
+
   /// Check that the field pointer is valid and the field has not already been registered.
   void CheckFieldIsRegistrable(const std::string & field_name, T * field) const
   {
@@ -140,9 +244,9 @@ protected:
   }
 
   /// Ensure that a returned shared pointer is valid.
-  inline std::shared_ptr<T> EnsureFieldPointerIsNonNull(const_iterator & iterator) const
+  inline const std::shared_ptr<T> & EnsureFieldPointerIsNonNull(const_iterator iterator) const
   {
-    auto owned_ptr = iterator->second;
+    const auto & owned_ptr = iterator->second;
 
     if (!owned_ptr)
     {
@@ -166,10 +270,22 @@ protected:
     return derived_ptr;
   }
 
-  /// Clear all associations between names and fields.
-  void DeregisterAll() { _field_map.clear(); }
+  /// Clear all associations between names and fields. Existing handles remain valid.
+  void DeregisterAll()
+  {
+    _field_map.clear();
+    ++_revision;
+    std::fill(_slots.begin(), _slots.end(), nullptr);
+  }
 
 private:
   MapType _field_map{};
+
+  /// Interned names and the flat storage indexed by their handles.
+  std::map<std::string, Handle> _handles{};
+  std::vector<T *> _slots{};
+  std::vector<std::string> _handle_names{};
+
+  std::size_t _revision{0};
 };
 } // namespace hephaestus
\ No newline at end of file
@@ -20,6 +20,27 @@ ProblemBuilder::SetMesh(std::shared_ptr<mfem::ParMesh> pmesh)
   MPI_Comm_rank(pmesh->GetComm(), &(GetProblem()->_myid));
 }
 
+void
+ProblemBuilder::SetMeshHierarchy(std::shared_ptr<mfem::ParMesh> coarse_pmesh, int num_refinements)
+{
+  logger.info("Building Mesh Hierarchy with {} uniform refinements", num_refinements);
+
+  auto & mesh_hierarchy = GetProblem()->_mesh_hierarchy;
+  mesh_hierarchy.clear();
+  mesh_hierarchy.push_back(std::move(coarse_pmesh));
+
+  // Each level is refined from a copy of the level below, so it keeps the refinement
+  // transformations needed to build the prolongation between them.
+  for (int i = 0; i < num_refinements; ++i)
+  {
+    auto fine_pmesh = std::make_shared<mfem::ParMesh>(*mesh_hierarchy.back());
+    fine_pmesh->UniformRefinement();
+    mesh_hierarchy.push_back(std::move(fine_pmesh));
+  }
+
+  SetMesh(mesh_hierarchy.back());
+}
+
 void
 ProblemBuilder::SetFESpaces(hephaestus::FESpaces & fespaces)
 {
@@ -207,6 +228,8 @@ ProblemBuilder::ConstructJacobianPreconditioner()
 {
   auto precond = std::make_shared<mfem::HypreBoomerAMG>();
   precond->SetPrintLevel(GetGlobalPrintLevel());
+  precond->SetStrengthThresh(
+      GetProblem()->_solver_options.GetOptionalNumericParam<double>("AMGStrengthThreshold", 0.25));
 
   GetProblem()->_jacobian_preconditioner = precond;
 }
@@ -222,26 +245,59 @@ ProblemBuilder::ConstructJacobianSolverWithOptions(SolverType type, SolverParams
 {
   const auto & solver_options = GetProblem()->_solver_options;
 
-  const auto tolerance =
-      solver_options.GetOptionalParam<float>("Tolerance", default_params._tolerance);
-  const auto abs_tolerance =
-      solver_options.GetOptionalParam<float>("AbsTolerance", default_params._abs_tolerance);
-  const auto max_iter =
-      solver_options.GetOptionalParam<unsigned int>("MaxIter", default_params._max_iteration);
-  const auto print_level =
-      solver_options.GetOptionalParam<int>("PrintLevel", default_params._print_level);
-  const auto k_dim = solver_options.GetOptionalParam<unsigned int>("KDim", default_params._k_dim);
+  if (solver_options.GetOptionalParam<bool>("Autotune", false))
+  {
+    ConstructAutotunedJacobianSolver(type, default_params);
+    return;
+  }
+
+  const auto params = hephaestus::LinearSolverParams::Parse(solver_options, default_params);
+  const auto tolerance = params._tolerance;
+  const auto abs_tolerance = params._abs_tolerance;
+  const auto max_iter = params._max_iteration;
+  const auto print_level = params._print_level;
+  const auto k_dim = params._k_dim;
+
+  // With iterative refinement, the Krylov solve only needs to reduce the residual by a modest
+  // factor; the outer double-precision refinement loop recovers the requested tolerance. Opt-in,
+  // as with double-precision inner solves it gains no accuracy.
+  const auto use_refinement = solver_options.GetOptionalParam<bool>("IterativeRefinement", false);
+  if (use_refinement)
+  {
+    logger.info("Iterative refinement enabled. Inner solves are in double precision, so each "
+                "refinement step restarts the Krylov solve without a precision benefit.");
+  }
+  const auto krylov_tolerance =
+      use_refinement ? solver_options.GetOptionalNumericParam<double>("InnerTolerance", 1.0e-4)
+                     : tolerance;
 
   auto preconditioner =
       std::dynamic_pointer_cast<mfem::HypreSolver>(GetProblem()->_jacobian_preconditioner);
 
+  // Hypre Krylov solvers can only be preconditioned by hypre solvers. Other preconditioners (e.g.
+  // p-multigrid) are paired with the equivalent MFEM Krylov solver instead.
+  const bool use_mfem_krylov = GetProblem()->_jacobian_preconditioner && !preconditioner;
+
   switch (type)
   {
     case SolverType::HYPRE_PCG:
     {
+      if (use_mfem_krylov)
+      {
+        auto solver = std::make_shared<mfem::CGSolver>(GetProblem()->_comm);
+        solver->SetRelTol(krylov_tolerance);
+        solver->SetAbsTol(abs_tolerance);
+        solver->SetMaxIter(max_iter);
+        solver->SetPrintLevel(print_level);
+        solver->SetPreconditioner(*GetProblem()->_jacobian_preconditioner);
+
+        GetProblem()->_jacobian_solver = solver;
+        break;
+      }
+
       auto solver = std::make_shared<mfem::HyprePCG>(GetProblem()->_comm);
 
-      solver->SetTol(tolerance);
+      solver->SetTol(krylov_tolerance);
       solver->SetAbsTol(abs_tolerance);
       solver->SetMaxIter(max_iter);
       solver->SetPrintLevel(print_level);
@@ -254,9 +310,23 @@ ProblemBuilder::ConstructJacobianSolverWithOptions(SolverType type, SolverParams
     }
     case SolverType::HYPRE_GMRES:
     {
+      if (use_mfem_krylov)
+      {
+        auto solver = std::make_shared<mfem::GMRESSolver>(GetProblem()->_comm);
+        solver->SetRelTol(krylov_tolerance);
+        solver->SetAbsTol(abs_tolerance);
+        solver->SetMaxIter(max_iter);
+        solver->SetPrintLevel(print_level);
+        solver->SetPreconditioner(*GetProblem()->_jacobian_preconditioner);
+        solver->SetKDim(k_dim);
+
+        GetProblem()->_jacobian_solver = solver;
+        break;
+      }
+
       auto solver = std::make_shared<mfem::HypreGMRES>(GetProblem()->_comm);
 
-      solver->SetTol(tolerance);
+      solver->SetTol(krylov_tolerance);
       solver->SetAbsTol(abs_tolerance);
       solver->SetMaxIter(max_iter);
       solver->SetKDim(k_dim);
@@ -270,9 +340,23 @@ ProblemBuilder::ConstructJacobianSolverWithOptions(SolverType type, SolverParams
     }
     case SolverType::HYPRE_FGMRES:
     {
+      if (use_mfem_krylov)
+      {
+        auto solver = std::make_shared<mfem::FGMRESSolver>(GetProblem()->_comm);
+        solver->SetRelTol(krylov_tolerance);
+        solver->SetAbsTol(abs_tolerance);
+        solver->SetMaxIter(max_iter);
+        solver->SetPrintLevel(print_level);
+        solver->SetPreconditioner(*GetProblem()->_jacobian_preconditioner);
+        solver->SetKDim(k_dim);
+
+        GetProblem()->_jacobian_solver = solver;
+        break;
+      }
+
       auto solver = std::make_shared<mfem::HypreFGMRES>(GetProblem()->_comm);
 
-      solver->SetTol(tolerance);
+      solver->SetTol(krylov_tolerance);
       solver->SetMaxIter(max_iter);
       solver->SetKDim(k_dim);
       solver->SetPrintLevel(print_level);
@@ -287,10 +371,41 @@ ProblemBuilder::ConstructJacobianSolverWithOptions(SolverType type, SolverParams
     {
       auto solver = std::make_shared<mfem::HypreBoomerAMG>();
 
-      solver->SetTol(tolerance);
+      solver->SetTol(krylov_tolerance);
+      solver->SetMaxIter(max_iter);
+      solver->SetPrintLevel(print_level);
+
+      GetProblem()->_jacobian_solver = solver;
+      break;
+    }
+    case SolverType::PIPELINED_CG:
+    {
+      auto solver = std::make_shared<hephaestus::PipelinedCGSolver>(GetProblem()->_comm);
+
+      solver->SetRelTol(krylov_tolerance);
+      solver->SetAbsTol(abs_tolerance);
+      solver->SetMaxIter(max_iter);
+      solver->SetPrintLevel(print_level);
+
+      if (GetProblem()->_jacobian_preconditioner)
+        solver->SetPreconditioner(*GetProblem()->_jacobian_preconditioner);
+
+      GetProblem()->_jacobian_solver = solver;
+      break;
+    }
+    case SolverType::SINGLE_REDUCE_GMRES:
+    {
+      auto solver = std::make_shared<hephaestus::SingleReduceGMRESSolver>(GetProblem()->_comm);
+
+      solver->SetRelTol(krylov_tolerance);
+      solver->SetAbsTol(abs_tolerance);
       solver->SetMaxIter(max_iter);
+      solver->SetKDim(k_dim);
       solver->SetPrintLevel(print_level);
 
+      if (GetProblem()->_jacobian_preconditioner)
+        solver->SetPreconditioner(*GetProblem()->_jacobian_preconditioner);
+
       GetProblem()->_jacobian_solver = solver;
       break;
     }
@@ -307,17 +422,123 @@ ProblemBuilder::ConstructJacobianSolverWithOptions(SolverType type, SolverParams
       break;
     }
   }
+
+  if (use_refinement)
+  {
+    auto refinement = std::make_shared<hephaestus::IterativeRefinementSolver>(
+        GetProblem()->_comm, GetProblem()->_jacobian_solver);
+
+    refinement->SetRelTol(tolerance);
+    refinement->SetAbsTol(abs_tolerance);
+    refinement->SetMaxIter(solver_options.GetOptionalParam<unsigned int>("RefinementMaxIter", 20));
+    refinement->SetPrintLevel(print_level);
+
+    GetProblem()->_jacobian_solver = refinement;
+  }
+}
+
+std::vector<ProblemBuilder::AutotuneCandidate>
+ProblemBuilder::GetAutotuneCandidates(SolverType type) const
+{
+  std::vector<AutotuneCandidate> candidates{{"default", type, {}}};
+
+  // Krylov variants.
+  switch (type)
+  {
+    case SolverType::HYPRE_PCG:
+    {
+      candidates.push_back({"pipelined_cg", SolverType::PIPELINED_CG, {}});
+      break;
+    }
+    case SolverType::HYPRE_GMRES:
+    case SolverType::HYPRE_FGMRES:
+    {
+      candidates.push_back({"kdim_30", type, {{"KDim", 30u}}});
+      candidates.push_back({"single_reduce_gmres", SolverType::SINGLE_REDUCE_GMRES, {}});
+      break;
+    }
+    default:
+      break;
+  }
+
+  // Preconditioner variants.
+  const auto & preconditioner = GetProblem()->_jacobian_preconditioner;
+  if (std::dynamic_pointer_cast<hephaestus::HypreMaterialAMS>(preconditioner))
+  {
+    candidates.push_back({"ams_cycle_1", type, {{"AMSCycleType", 1}}});
+    candidates.push_back({"ams_cycle_13", type, {{"AMSCycleType", 13}}});
+    candidates.push_back({"ams_strength_0.5", type, {{"AMSStrengthThreshold", 0.5f}}});
+  }
+  else if (std::dynamic_pointer_cast<mfem::HypreBoomerAMG>(preconditioner))
+  {
+    candidates.push_back({"amg_strength_0.5", type, {{"AMGStrengthThreshold", 0.5f}}});
+  }
+
+  return candidates;
+}
+
+void
+ProblemBuilder::ConstructAutotunedJacobianSolver(SolverType type, SolverParams default_params)
+{
+  auto * problem = GetProblem();
+  const hephaestus::InputParameters user_options = problem->_solver_options;
+
+  auto autotune = std::make_shared<hephaestus::AutotuneSolver>(
+      problem->_comm,
+      user_options.GetOptionalParam<std::string>("AutotuneRecord", ""),
+      user_options.GetOptionalNumericParam<double>("AutotuneAcceptance", 1.0e-8),
+      user_options.GetOptionalParam<int>("AutotuneSolvesPerSetup", 1));
+
+  for (const auto & candidate : GetAutotuneCandidates(type))
+  {
+    problem->_solver_options = user_options;
+    problem->_solver_options.SetParam("Autotune", false);
+    for (const auto & [param_name, value] : candidate._overrides)
+    {
+      problem->_solver_options.SetParam(param_name, value);
+    }
+
+    ConstructJacobianPreconditioner();
+    ConstructJacobianSolverWithOptions(candidate._type, default_params);
+
+    autotune->AddCandidate(
+        candidate._name, problem->_jacobian_solver, problem->_jacobian_preconditioner);
+  }
+
+  problem->_solver_options = user_options;
+  problem->_jacobian_solver = autotune;
+
+  // Only the selected candidate's preconditioner is kept, once tuning has chosen one.
+  problem->_jacobian_preconditioner.reset();
+  autotune->SetPreconditionerHandle(&problem->_jacobian_preconditioner);
 }
 
 void
 ProblemBuilder::ConstructNonlinearSolver()
 {
+  const auto & solver_options = GetProblem()->_solver_options;
   auto nl_solver = std::make_shared<mfem::NewtonSolver>(GetProblem()->_comm);
 
   // Defaults to one iteration, without further nonlinear iterations
-  nl_solver->SetRelTol(0.0);
-  nl_solver->SetAbsTol(0.0);
-  nl_solver->SetMaxIter(1);
+  const auto nl_max_iter = solver_options.GetOptionalParam<unsigned int>("NonlinearMaxIter", 1);
+  nl_solver->SetMaxIter(nl_max_iter);
+
+  if (nl_max_iter > 1)
+  {
+    nl_solver->SetRelTol(
+        solver_options.GetOptionalNumericParam<double>("NonlinearTolerance", 1.0e-8));
+    nl_solver->SetAbsTol(
+        solver_options.GetOptionalNumericParam<double>("NonlinearAbsTolerance", 0.0));
+
+    // Eisenstat-Walker forcing terms: each linear tolerance follows the Newton residual reduction,
+    // so early iterations are not over-solved.
+    nl_solver->SetAdaptiveLinRtol(2, 0.5, 0.9);
+  }
+  else
+  {
+    nl_solver->SetRelTol(0.0);
+    nl_solver->SetAbsTol(0.0);
+  }
 
   GetProblem()->_nonlinear_solver = nl_solver;
 }
@@ -3,6 +3,7 @@
 #include "equation_system.hpp"
 #include "gridfunctions.hpp"
 #include "inputs.hpp"
+#include "scratch_pool.hpp"
 #include "sources.hpp"
 #include <fstream>
 #include <iostream>
@@ -19,6 +20,9 @@ public:
   virtual ~Problem();
 
   std::shared_ptr<mfem::ParMesh> _pmesh{nullptr};
+
+  // Uniformly refined meshes ordered from coarsest to finest, if set. The finest is _pmesh.
+  std::vector<std::shared_ptr<mfem::ParMesh>> _mesh_hierarchy;
   hephaestus::BCMap _bc_map;
   hephaestus::Coefficients _coefficients;
   hephaestus::AuxSolvers _preprocessors;
@@ -38,6 +42,9 @@ public:
   hephaestus::FESpaces _fespaces;
   hephaestus::GridFunctions _gridfunctions;
 
+  // Scratch vectors for per-step temporaries, reused across steps.
+  hephaestus::ScratchPool _scratch;
+
   MPI_Comm _comm;
   int _myid;
   int _num_procs;
@@ -66,6 +73,10 @@ public:
   }
 
   void SetMesh(std::shared_ptr<mfem::ParMesh> pmesh);
+
+  /// Builds a hierarchy of @a num_refinements uniform refinements of @a coarse_pmesh and sets the
+  /// finest as the problem mesh. Steady solvers use the hierarchy for nested iteration.
+  void SetMeshHierarchy(std::shared_ptr<mfem::ParMesh> coarse_pmesh, int num_refinements);
   void SetFESpaces(hephaestus::FESpaces & fespaces);
   void SetGridFunctions(hephaestus::GridFunctions & gridfunctions);
   void SetBoundaryConditions(hephaestus::BCMap & bc_map);
@@ -123,32 +134,43 @@ protected:
     HYPRE_GMRES,
     HYPRE_FGMRES,
     HYPRE_AMG,
-    SUPER_LU
+    SUPER_LU,
+    PIPELINED_CG,
+    SINGLE_REDUCE_GMRES
   };
 
   /// Structure containing default parameters which can be passed to @a ConstructJacobianSolverWithOptions.
   /// These will be used if the user has not supplied their own values.
-  struct SolverParams
-  {
-    double _tolerance;
-    double _abs_tolerance;
-
-    unsigned int _max_iteration;
-
-    int _print_level;
-    int _k_dim;
-  };
+  using SolverParams = hephaestus::LinearSolverParams;
 
   /// Called in @a ConstructJacobianSolver. This will create a solver of the chosen type and use the user's input
   /// parameters if they have been provided.
   void ConstructJacobianSolverWithOptions(SolverType type,
                                           SolverParams default_params = {
-                                              ._tolerance = 1e-16,
+                                              ._tolerance = 1e-12,
                                               ._abs_tolerance = 1e-16,
                                               ._max_iteration = 1000,
                                               ._print_level = GetGlobalPrintLevel(),
                                               ._k_dim = 10});
 
+  /// A configuration benchmarked by the solver autotuner: a solver type plus solver option
+  /// overrides applied on top of the user's solver options.
+  struct AutotuneCandidate
+  {
+    std::string _name;
+    SolverType _type;
+    std::vector<std::pair<std::string, std::any>> _overrides;
+  };
+
+  /// Returns the configurations benchmarked when the "Autotune" solver option is set. Override in
+  /// derived classes to tune formulation-specific options.
+  [[nodiscard]] virtual std::vector<AutotuneCandidate> GetAutotuneCandidates(SolverType type) const;
+
+  /// Called in @a ConstructJacobianSolverWithOptions if the "Autotune" solver option is set. Builds
+  /// each candidate's preconditioner and solver, and wraps them in an @a AutotuneSolver that picks
+  /// the fastest converging one on the first solve.
+  void ConstructAutotunedJacobianSolver(SolverType type, SolverParams default_params);
+
   /// Overridden in derived classes.
   [[nodiscard]] virtual hephaestus::Problem * GetProblem() const = 0;
 
@@ -53,6 +53,10 @@ public:
 
   ~TimeDomainEquationSystemProblemBuilder() override = default;
 
+  /// Time derivatives are registered by the equation system for its trial variables only, when it
+  /// is initialized, rather than for every gridfunction.
+  void RegisterGridFunctions() override {}
+
   /// NB: - note use of final. Ensure that the equation system is initialized.
   void InitializeKernels() final;
 
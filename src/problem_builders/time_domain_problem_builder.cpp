@@ -1,4 +1,6 @@
 #include "time_domain_problem_builder.hpp"
+#include "dual_leapfrog_solver.hpp"
+#include "krylov_exponential_solver.hpp"
 
 namespace hephaestus
 {
@@ -11,9 +13,12 @@ TimeDomainProblemBuilder::RegisterTimeDerivatives(std::vector<std::string> gridf
 
   for (auto & gridfunction_name : gridfunction_names)
   {
-    gridfunctions.Register(GetTimeDerivativeName(gridfunction_name),
-                           std::make_shared<mfem::ParGridFunction>(
-                               gridfunctions.Get(gridfunction_name)->ParFESpace()));
+    if (!gridfunctions.Has(GetTimeDerivativeName(gridfunction_name)))
+    {
+      gridfunctions.Register(GetTimeDerivativeName(gridfunction_name),
+                             std::make_shared<mfem::ParGridFunction>(
+                                 gridfunctions.Get(gridfunction_name)->ParFESpace()));
+    }
 
     time_derivatives.push_back(gridfunctions.Get(GetTimeDerivativeName(gridfunction_name)));
   }
@@ -59,7 +64,27 @@ TimeDomainProblemBuilder::ConstructState()
 void
 TimeDomainProblemBuilder::ConstructTimestepper()
 {
-  GetProblem()->_ode_solver = std::make_unique<mfem::BackwardEulerSolver>();
+  const auto time_integrator = GetProblem()->_solver_options.GetOptionalParam<std::string>(
+      "TimeIntegrator", "BackwardEuler");
+
+  if (time_integrator == "BackwardEuler")
+  {
+    GetProblem()->_ode_solver = std::make_unique<mfem::BackwardEulerSolver>();
+  }
+  else if (time_integrator == "KrylovExponential")
+  {
+    GetProblem()->_ode_solver = std::make_unique<hephaestus::KrylovExponentialSolver>(
+        GetProblem()->_solver_options, *GetProblem()->_jacobian_solver);
+  }
+  else if (time_integrator == "Leapfrog")
+  {
+    GetProblem()->_ode_solver = std::make_unique<hephaestus::DualLeapfrogSolver>(
+        GetProblem()->_solver_options, *GetProblem());
+  }
+  else
+  {
+    MFEM_ABORT("Unknown time integrator " << time_integrator << ".");
+  }
   GetProblem()->_ode_solver->Init(*(GetProblem()->GetOperator()));
 }
 
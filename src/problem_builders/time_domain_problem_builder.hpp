@@ -45,6 +45,8 @@ public:
 
   auto ReturnProblem() { return ProblemBuilder::ReturnProblem<TimeDomainProblem>(); }
 
+  /// Registers time derivatives of the named gridfunctions, if not already present. May be used to
+  /// create derivative fields on demand, e.g. for postprocessing.
   static std::vector<mfem::ParGridFunction *>
   RegisterTimeDerivatives(std::vector<std::string> gridfunction_names,
                           hephaestus::GridFunctions & gridfunctions);
@@ -6,6 +6,11 @@ void
 EquationSystemProblemOperator::SetGridFunctions()
 {
   _trial_var_names = GetEquationSystem()->_trial_var_names;
+
+  // Set here, as the Jacobian preconditioner is built on the system FE space.
+  GetEquationSystem()->SetStaticCondensation(
+      _problem._solver_options.GetOptionalParam<bool>("StaticCondensation", false));
+
   ProblemOperator::SetGridFunctions();
 }
 
@@ -14,6 +19,9 @@ EquationSystemProblemOperator::Init(mfem::Vector & X)
 {
   ProblemOperator::Init(X);
 
+  GetEquationSystem()->SetLeanAssembly(
+      _problem._solver_options.GetOptionalParam<bool>("LeanAssembly", false));
+  GetEquationSystem()->SetScratchPool(_problem._scratch);
   GetEquationSystem()->BuildEquationSystem(_problem._bc_map, _problem._sources);
 }
 
@@ -10,4 +10,33 @@ ProblemOperator::SetGridFunctions()
   width = height = _true_offsets[_trial_variables.size()];
 };
 
+void
+ProblemOperator::RecordSourceLoads(mfem::ParFiniteElementSpace & fespace)
+{
+  if (_record_source_loads)
+  {
+    return;
+  }
+
+  mfem::ParLinearForm lf(
+      &fespace,
+      _problem._scratch.GetVector("ProblemOperator::source_lf", fespace.GetVSize()).GetData());
+  lf = 0.0;
+  _problem._sources.Apply(&lf, _problem._scratch, _source_loads);
+  _record_source_loads = true;
+}
+
+void
+ProblemOperator::ApplySources(mfem::ParLinearForm & lf)
+{
+  if (_record_source_loads)
+  {
+    _problem._sources.Apply(&lf, _problem._scratch, _source_loads);
+  }
+  else
+  {
+    _problem._sources.Apply(&lf);
+  }
+}
+
 } // namespace hephaestus
\ No newline at end of file
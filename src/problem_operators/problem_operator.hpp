@@ -1,9 +1,12 @@
 #pragma once
 #include "../common/pfem_extras.hpp"
+#include "adjoint.hpp"
 #include "hephaestus_solvers.hpp"
 #include "problem_builder_base.hpp"
 #include "problem_operator_interface.hpp"
 
+#include <map>
+
 namespace hephaestus
 {
 /// Steady-state problem operator with no equation system.
@@ -16,7 +19,31 @@ public:
   void SetGridFunctions() override;
 
   virtual void Solve(mfem::Vector & X) {}
+
+  /// Solves the adjoint of the last solve for @a objective, and sets @a sensitivities to the
+  /// derivatives of the objective with respect to the problem's coefficients and sources.
+  virtual void SolveAdjoint(hephaestus::AdjointObjective & objective,
+                            hephaestus::AdjointSensitivities & sensitivities)
+  {
+    MFEM_ABORT("Adjoint solves are not supported by this problem operator.");
+  }
+
   void Mult(const mfem::Vector & x, mfem::Vector & y) const override {}
+
+protected:
+  // Sets _source_loads to the true DOF load vector on fespace of each of the problem's sources,
+  // unless forward solves already keep them, and has later forward solves keep them. Collecting
+  // the loads costs a parallel assembly per source, so forward solves only do so once an adjoint
+  // has been requested.
+  void RecordSourceLoads(mfem::ParFiniteElementSpace & fespace);
+
+  // Applies the problem's sources to lf, keeping the load of each in _source_loads if requested.
+  void ApplySources(mfem::ParLinearForm & lf);
+
+  bool _record_source_loads{false};
+
+  // Load vector of each of the problem's sources in the last solve, reused by adjoint solves.
+  std::map<std::string, const mfem::Vector *> _source_loads;
 };
 
 } // namespace hephaestus
\ No newline at end of file
@@ -3,6 +3,25 @@
 namespace hephaestus
 {
 
+namespace
+{
+
+// Writes the true DOFs of gridfunctions to true_vector, whose blocks are given by offsets.
+void
+ProjectToTrueDofs(const std::vector<mfem::ParGridFunction *> & gridfunctions,
+                  const mfem::Array<int> & offsets,
+                  mfem::Vector & true_vector)
+{
+  mfem::Vector block;
+  for (std::size_t ind = 0; ind < gridfunctions.size(); ++ind)
+  {
+    block.MakeRef(true_vector, offsets[ind], offsets[ind + 1] - offsets[ind]);
+    gridfunctions.at(ind)->ParallelProject(block);
+  }
+}
+
+} // namespace
+
 void
 TimeDomainEquationSystemProblemOperator::SetGridFunctions()
 {
@@ -10,6 +29,10 @@ TimeDomainEquationSystemProblemOperator::SetGridFunctions()
   _trial_variable_time_derivatives =
       _problem._gridfunctions.Get(GetEquationSystem()->_trial_var_time_derivative_names);
 
+  // Set here, as the Jacobian preconditioner is built on the system FE space.
+  GetEquationSystem()->SetStaticCondensation(
+      _problem._solver_options.GetOptionalParam<bool>("StaticCondensation", false));
+
   TimeDomainProblemOperator::SetGridFunctions();
 }
 
@@ -24,7 +47,16 @@ TimeDomainEquationSystemProblemOperator::Init(mfem::Vector & X)
     *(_trial_variable_time_derivatives.at(i)) = 0.0;
   }
 
+  GetEquationSystem()->SetLeanAssembly(
+      _problem._solver_options.GetOptionalParam<bool>("LeanAssembly", false));
+  GetEquationSystem()->SetScratchPool(_problem._scratch);
   GetEquationSystem()->BuildEquationSystem(_problem._bc_map, _problem._sources);
+
+  if (_problem._solver_options.GetOptionalParam<bool>("AdaptiveTolerance", false))
+  {
+    _tolerance_policy = std::make_unique<hephaestus::LinearTolerancePolicy>(
+        _problem._solver_options, _problem._comm);
+  }
 }
 
 void
@@ -33,21 +65,153 @@ TimeDomainEquationSystemProblemOperator::ImplicitSolve(const double dt,
                                                        mfem::Vector & dX_dt)
 {
   dX_dt = 0.0;
-  for (unsigned int ind = 0; ind < _trial_variables.size(); ++ind)
-  {
-    _trial_variables.at(ind)->MakeRef(
-        _trial_variables.at(ind)->ParFESpace(), const_cast<mfem::Vector &>(X), _true_offsets[ind]);
-    _trial_variable_time_derivatives.at(ind)->MakeRef(
-        _trial_variable_time_derivatives.at(ind)->ParFESpace(), dX_dt, _true_offsets[ind]);
-  }
+  BindStateViews(X, dX_dt);
   _problem._coefficients.SetTime(GetTime());
   BuildEquationSystemOperator(dt);
 
+  if (_tolerance_policy && !LinearTolerancePolicy::SetRelativeTolerance(
+                               *_problem._jacobian_solver, _tolerance_policy->GetTolerance()))
+  {
+    logger.warn("AdaptiveTolerance has no effect, as the tolerance of the Jacobian solver cannot "
+                "be changed. The solver tolerance is used for every step.");
+    _tolerance_policy.reset();
+  }
+
   _problem._nonlinear_solver->SetSolver(*_problem._jacobian_solver);
   _problem._nonlinear_solver->SetOperator(*GetEquationSystem());
   _problem._nonlinear_solver->Mult(_true_rhs, _true_x);
 
   GetEquationSystem()->RecoverFEMSolution(_true_x, _problem._gridfunctions);
+
+  if (_tolerance_policy)
+  {
+    // X and dX_dt hold local DOFs, which count DOFs shared between ranks on each of them, so the
+    // truncation error is estimated from their true DOFs. X is still the state at the start of
+    // the step.
+    auto & scratch = _problem._scratch;
+    const int true_size = _block_true_offsets.Last();
+    auto & true_state = scratch.GetVector("TimeDomainEquationSystemProblemOperator::true_state",
+                                          true_size);
+    auto & true_rate = scratch.GetVector("TimeDomainEquationSystemProblemOperator::true_rate",
+                                         true_size);
+    ProjectToTrueDofs(_trial_variables, _block_true_offsets, true_state);
+    ProjectToTrueDofs(_trial_variable_time_derivatives, _block_true_offsets, true_rate);
+    _tolerance_policy->Update(dt, true_state, true_rate);
+  }
+}
+
+void
+TimeDomainEquationSystemProblemOperator::GetTrueState(mfem::Vector & true_state) const
+{
+  true_state.SetSize(_block_true_offsets.Last());
+  ProjectToTrueDofs(_trial_variables, _block_true_offsets, true_state);
+}
+
+void
+TimeDomainEquationSystemProblemOperator::SetTrueState(mfem::Vector & true_state,
+                                                      mfem::Vector & true_rate)
+{
+  mfem::Vector block;
+  for (unsigned int ind = 0; ind < _trial_variables.size(); ++ind)
+  {
+    const int size = _block_true_offsets[ind + 1] - _block_true_offsets[ind];
+    block.MakeRef(true_state, _block_true_offsets[ind], size);
+    _trial_variables.at(ind)->Distribute(block);
+    block.MakeRef(true_rate, _block_true_offsets[ind], size);
+    _trial_variable_time_derivatives.at(ind)->Distribute(block);
+  }
+}
+
+const mfem::Operator &
+TimeDomainEquationSystemProblemOperator::AssembleImplicitStep(double dt, mfem::Vector & rhs)
+{
+  _problem._coefficients.SetTime(GetTime());
+  BuildEquationSystemOperator(dt);
+  if (_true_rhs.Size() != _block_true_offsets.Last())
+  {
+    MFEM_ABORT("The implicit step operator does not act on the true state when static "
+               "condensation is enabled.");
+  }
+  rhs = _true_rhs;
+
+  return GetEquationSystem()->GetGradient(_true_x);
+}
+
+void
+TimeDomainEquationSystemProblemOperator::AssembleImplicitRHS(mfem::Vector & rhs)
+{
+  _problem._coefficients.SetTime(GetTime());
+  if (GetEquationSystem()->UsesLeanAssembly())
+  {
+    BuildEquationSystemOperator(GetEquationSystem()->_dt_coef.constant);
+  }
+  else
+  {
+    GetEquationSystem()->FormRightHandSide(_problem._bc_map, _problem._sources, _true_rhs);
+  }
+  rhs = _true_rhs;
+}
+
+const mfem::HypreParMatrix &
+TimeDomainEquationSystemProblemOperator::AssembleMassAndStiffness(
+    double dt,
+    std::unique_ptr<mfem::HypreParMatrix> & mass,
+    std::unique_ptr<mfem::HypreParMatrix> & stiffness,
+    mfem::Vector & load)
+{
+  std::unique_ptr<mfem::HypreParMatrix> doubled{nullptr};
+  const mfem::HypreParMatrix * single{nullptr};
+  for (const double step_size : {2.0 * dt, dt})
+  {
+    const auto * mat =
+        dynamic_cast<const mfem::HypreParMatrix *>(&AssembleImplicitStep(step_size, load));
+    if (mat == nullptr)
+    {
+      MFEM_ABORT("Mass and stiffness matrices require an assembled implicit step matrix.");
+    }
+
+    if (step_size == dt)
+    {
+      single = mat;
+    }
+    else
+    {
+      // Copied, as the matrix is freed when the next step is assembled.
+      doubled = std::make_unique<mfem::HypreParMatrix>(*mat);
+    }
+  }
+
+  stiffness.reset(mfem::Add(1.0 / dt, *doubled, -1.0 / dt, *single));
+  mass.reset(mfem::Add(2.0, *single, -1.0, *doubled));
+
+  // The right-hand side of the step of size dt is f - K u.
+  mfem::Vector state;
+  GetTrueState(state);
+  stiffness->Mult(1.0, state, 1.0, load);
+
+  return *single;
+}
+
+void
+TimeDomainEquationSystemProblemOperator::BindStateViews(const mfem::Vector & X,
+                                                        mfem::Vector & dX_dt)
+{
+  // The ODE solver normally passes the same state and derivative vectors on every step, in which
+  // case the gridfunctions already view them.
+  if (X.GetData() == _bound_state && dX_dt.GetData() == _bound_state_derivative)
+  {
+    return;
+  }
+
+  for (unsigned int ind = 0; ind < _trial_variables.size(); ++ind)
+  {
+    _trial_variables.at(ind)->MakeRef(
+        _trial_variables.at(ind)->ParFESpace(), const_cast<mfem::Vector &>(X), _true_offsets[ind]);
+    _trial_variable_time_derivatives.at(ind)->MakeRef(
+        _trial_variable_time_derivatives.at(ind)->ParFESpace(), dX_dt, _true_offsets[ind]);
+  }
+  _bound_state = X.GetData();
+  _bound_state_derivative = dX_dt.GetData();
 }
 
 void
@@ -25,6 +25,34 @@ public:
 
   void ImplicitSolve(const double dt, const mfem::Vector & X, mfem::Vector & dX_dt) override;
 
+  /// Writes the true DOFs of the trial variables to @a true_state, in the block layout of the
+  /// equation system.
+  void GetTrueState(mfem::Vector & true_state) const;
+
+  /// Sets the trial variables and their time derivatives from the true DOFs @a true_state and
+  /// @a true_rate, in the block layout of the equation system.
+  void SetTrueState(mfem::Vector & true_state, mfem::Vector & true_rate);
+
+  /// Assembles the linear system of an implicit step of size @a dt from the current state, and
+  /// returns its operator, which is valid until the system is next assembled. The right-hand side
+  /// is written to @a rhs.
+  const mfem::Operator & AssembleImplicitStep(double dt, mfem::Vector & rhs);
+
+  /// Assembles the right-hand side of the last assembled implicit step from the current state at
+  /// the operator's current time into @a rhs. Only the linear forms and sources are rebuilt; the
+  /// operator is reassembled only if lean assembly has freed its forms.
+  void AssembleImplicitRHS(mfem::Vector & rhs);
+
+  /// Recovers the mass matrix M and the stiffness matrix K of the semi-discrete system
+  /// M du/dt + K u = f from the implicit steps of sizes 2 @a dt and @a dt, which assemble M + dt K
+  /// with right-hand side f - K u. The load f at the current time and state is written to
+  /// @a load. The step of size @a dt is assembled last, and its operator is returned.
+  const mfem::HypreParMatrix &
+  AssembleMassAndStiffness(double dt,
+                           std::unique_ptr<mfem::HypreParMatrix> & mass,
+                           std::unique_ptr<mfem::HypreParMatrix> & stiffness,
+                           mfem::Vector & load);
+
   [[nodiscard]] hephaestus::TimeDependentEquationSystem * GetEquationSystem() const override
   {
     if (!_equation_system)
@@ -38,9 +66,22 @@ public:
 protected:
   void BuildEquationSystemOperator(double dt);
 
+  // Makes the trial variables and their time derivatives views into X and dX_dt, unless they
+  // already are.
+  void BindStateViews(const mfem::Vector & X, mfem::Vector & dX_dt);
+
 private:
   std::vector<mfem::ParGridFunction *> _trial_variable_time_derivatives;
+
+  // Data of the vectors the trial variables and their time derivatives currently view.
+  const double * _bound_state{nullptr};
+  const double * _bound_state_derivative{nullptr};
+
   std::unique_ptr<hephaestus::TimeDependentEquationSystem> _equation_system{nullptr};
+
+  // Sets each step's linear tolerance from the truncation error. Enabled with the
+  // "AdaptiveTolerance" solver option.
+  std::unique_ptr<hephaestus::LinearTolerancePolicy> _tolerance_policy{nullptr};
 };
 
 } // namespace hephaestus
\ No newline at end of file
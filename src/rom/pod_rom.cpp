@@ -0,0 +1,474 @@
+#include "pod_rom.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <random>
+
+namespace hephaestus
+{
+
+namespace
+{
+
+// Eigenvalues of a Gram matrix below this fraction of the largest are treated as zero. Rounding
+// errors in a Gram matrix are of order machine epsilon times its largest eigenvalue, so the
+// threshold is kept well above that, and drops singular values below 1e-6 of the largest.
+const double rank_tol = 1.0e-12;
+
+void
+AllreduceSum(MPI_Comm comm, mfem::DenseMatrix & mat)
+{
+  MPI_Allreduce(
+      MPI_IN_PLACE, mat.Data(), mat.Height() * mat.Width(), MPI_DOUBLE, MPI_SUM, comm);
+}
+
+// Replaces the columns of the distributed matrix mat by an orthonormal basis of their span, from
+// the eigendecomposition of their Gram matrix. This is repeated once to recover the orthogonality
+// lost to the conditioning of the Gram matrix.
+void
+Orthonormalise(MPI_Comm comm, mfem::DenseMatrix & mat)
+{
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    if (mat.Width() == 0)
+    {
+      return;
+    }
+
+    mfem::DenseMatrix gram(mat.Width());
+    mfem::MultAtB(mat, mat, gram);
+    AllreduceSum(comm, gram);
+
+    mfem::Vector eigenvalues;
+    mfem::DenseMatrix eigenvectors;
+    SymmetricEigensystem(gram, eigenvalues, eigenvectors);
+
+    int rank = 0;
+    while (rank < eigenvalues.Size() && eigenvalues(rank) > rank_tol * eigenvalues(0))
+    {
+      ++rank;
+    }
+
+    mfem::DenseMatrix transform(mat.Width(), rank);
+    for (int j = 0; j < rank; ++j)
+    {
+      for (int i = 0; i < mat.Width(); ++i)
+      {
+        transform(i, j) = eigenvectors(i, j) / sqrt(eigenvalues(j));
+      }
+    }
+
+    mfem::DenseMatrix orthonormal(mat.Height(), rank);
+    mfem::Mult(mat, transform, orthonormal);
+    mat = orthonormal;
+  }
+}
+
+} // namespace
+
+void
+ComputeRandomisedSVD(MPI_Comm comm,
+                     const std::vector<mfem::Vector> & snapshots,
+                     int rank,
+                     int oversampling,
+                     int power_iterations,
+                     unsigned int seed,
+                     mfem::DenseMatrix & basis,
+                     mfem::Vector & singular_values)
+{
+  const int num_snapshots = static_cast<int>(snapshots.size());
+  const int height = snapshots.empty() ? 0 : snapshots.front().Size();
+
+  mfem::DenseMatrix snapshot_matrix(height, num_snapshots);
+  for (int j = 0; j < num_snapshots; ++j)
+  {
+    snapshot_matrix.SetCol(j, snapshots[j]);
+  }
+
+  // Sample the range of the snapshots with a Gaussian sketch.
+  const int sketch_size = std::min(rank + oversampling, num_snapshots);
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> normal;
+  mfem::DenseMatrix sketch(num_snapshots, sketch_size);
+  for (int j = 0; j < sketch_size; ++j)
+  {
+    for (int i = 0; i < num_snapshots; ++i)
+    {
+      sketch(i, j) = normal(generator);
+    }
+  }
+
+  mfem::DenseMatrix range(height, sketch_size);
+  mfem::Mult(snapshot_matrix, sketch, range);
+  Orthonormalise(comm, range);
+
+  // Subspace iterations sharpen the sampled range when the singular values decay slowly.
+  for (int it = 0; it < power_iterations; ++it)
+  {
+    mfem::DenseMatrix projected(num_snapshots, range.Width());
+    mfem::MultAtB(snapshot_matrix, range, projected);
+    AllreduceSum(comm, projected);
+
+    range.SetSize(height, projected.Width());
+    mfem::Mult(snapshot_matrix, projected, range);
+    Orthonormalise(comm, range);
+  }
+
+  // SVD of the small matrix Q^T S from the eigendecomposition of Q^T S S^T Q.
+  mfem::DenseMatrix reduced(range.Width(), num_snapshots);
+  mfem::MultAtB(range, snapshot_matrix, reduced);
+  AllreduceSum(comm, reduced);
+
+  mfem::DenseMatrix reduced_gram(range.Width());
+  mfem::MultABt(reduced, reduced, reduced_gram);
+
+  mfem::Vector eigenvalues;
+  mfem::DenseMatrix eigenvectors;
+  SymmetricEigensystem(reduced_gram, eigenvalues, eigenvectors);
+
+  int num_vectors = 0;
+  while (num_vectors < std::min(rank, eigenvalues.Size()) &&
+         eigenvalues(num_vectors) > rank_tol * eigenvalues(0))
+  {
+    ++num_vectors;
+  }
+
+  singular_values.SetSize(num_vectors);
+  mfem::DenseMatrix leading(range.Width(), num_vectors);
+  for (int j = 0; j < num_vectors; ++j)
+  {
+    singular_values(j) = sqrt(eigenvalues(j));
+    for (int i = 0; i < range.Width(); ++i)
+    {
+      leading(i, j) = eigenvectors(i, j);
+    }
+  }
+
+  basis.SetSize(height, num_vectors);
+  mfem::Mult(range, leading, basis);
+}
+
+PODReducedOrderModel::PODReducedOrderModel(const hephaestus::InputParameters & params)
+  : _comm(params.GetOptionalParam<MPI_Comm>("Communicator", MPI_COMM_WORLD)),
+    _basis_size(params.GetOptionalParam<int>("BasisSize", 20)),
+    _oversampling(params.GetOptionalParam<int>("Oversampling", 10)),
+    _power_iterations(params.GetOptionalParam<int>("PowerIterations", 1)),
+    _enrichment_tol(params.GetOptionalNumericParam<double>("EnrichmentTolerance", 1.0e-6)),
+    _seed(params.GetOptionalParam<unsigned int>("Seed", 0))
+{
+}
+
+void
+PODReducedOrderModel::AddSnapshot(const mfem::Vector & true_state)
+{
+  if (!_snapshots.empty() && true_state.Size() != _snapshots.front().Size())
+  {
+    MFEM_ABORT("POD snapshot of size " << true_state.Size() << " does not match the size "
+                                       << _snapshots.front().Size() << " of earlier snapshots.");
+  }
+
+  _snapshots.push_back(true_state);
+}
+
+void
+PODReducedOrderModel::ComputeBasis()
+{
+  if (_snapshots.empty())
+  {
+    MFEM_ABORT("No snapshots have been added to the POD model.");
+  }
+
+  spdlog::stopwatch sw;
+
+  ComputeRandomisedSVD(_comm,
+                       _snapshots,
+                       _basis_size,
+                       _oversampling,
+                       _power_iterations,
+                       _seed,
+                       _basis,
+                       _singular_values);
+  _num_compressed = _snapshots.size();
+  _projected = false;
+  UpdateTruncationError();
+
+  logger.info("POD basis of {} vectors from {} snapshots, truncation error {:.3e}: {} seconds",
+              BasisSize(),
+              NumSnapshots(),
+              _truncation_error,
+              sw);
+}
+
+int
+PODReducedOrderModel::Enrich()
+{
+  if (_num_compressed == _snapshots.size())
+  {
+    return 0;
+  }
+  if (BasisSize() == 0)
+  {
+    ComputeBasis();
+    return BasisSize();
+  }
+
+  // Compress the part of the new snapshots outside the span of the basis.
+  std::vector<mfem::Vector> residuals(_snapshots.begin() + _num_compressed, _snapshots.end());
+  mfem::Vector coefficients;
+  for (auto & residual : residuals)
+  {
+    Restrict(residual, coefficients);
+    _basis.AddMult_a(-1.0, coefficients, residual);
+  }
+
+  mfem::DenseMatrix directions;
+  mfem::Vector singular_values;
+  ComputeRandomisedSVD(_comm,
+                       residuals,
+                       _basis_size,
+                       _oversampling,
+                       _power_iterations,
+                       _seed + static_cast<unsigned int>(_num_compressed),
+                       directions,
+                       singular_values);
+
+  int num_added = 0;
+  while (num_added < singular_values.Size() &&
+         singular_values(num_added) > _enrichment_tol * _singular_values(0))
+  {
+    ++num_added;
+  }
+
+  mfem::DenseMatrix added(_basis.Height(), num_added);
+  added.CopyMN(directions, _basis.Height(), num_added, 0, 0);
+
+  // Orthogonalise against the basis again to remove the round-off of the first projection.
+  mfem::DenseMatrix overlap(BasisSize(), num_added);
+  mfem::MultAtB(_basis, added, overlap);
+  AllreduceSum(_comm, overlap);
+  mfem::DenseMatrix correction(_basis.Height(), num_added);
+  mfem::Mult(_basis, overlap, correction);
+  added -= correction;
+  Orthonormalise(_comm, added);
+  num_added = added.Width();
+
+  mfem::DenseMatrix basis(_basis.Height(), BasisSize() + num_added);
+  basis.CopyMN(_basis, 0, 0);
+  basis.CopyMN(added, 0, BasisSize());
+
+  mfem::Vector all_singular_values(BasisSize() + num_added);
+  for (int i = 0; i < all_singular_values.Size(); ++i)
+  {
+    all_singular_values(i) =
+        i < BasisSize() ? _singular_values(i) : singular_values(i - BasisSize());
+  }
+
+  _basis.Swap(basis);
+  _singular_values.Swap(all_singular_values);
+  _num_compressed = _snapshots.size();
+  _projected = false;
+  UpdateTruncationError();
+
+  logger.info("POD basis enriched with {} vectors, truncation error {:.3e}",
+              num_added,
+              _truncation_error);
+
+  return num_added;
+}
+
+void
+PODReducedOrderModel::Project(
+    hephaestus::TimeDomainEquationSystemProblemOperator & problem_operator, double dt)
+{
+  if (BasisSize() == 0)
+  {
+    MFEM_ABORT("The POD basis must be computed before the system is projected.");
+  }
+
+  std::unique_ptr<mfem::HypreParMatrix> mass{nullptr}, stiffness{nullptr};
+  mfem::Vector load;
+  problem_operator.AssembleMassAndStiffness(dt, mass, stiffness, load);
+
+  Project(*mass, *stiffness, load);
+}
+
+void
+PODReducedOrderModel::Project(const mfem::Operator & mass,
+                              const mfem::Operator & stiffness,
+                              const mfem::Vector & load)
+{
+  if (BasisSize() == 0)
+  {
+    MFEM_ABORT("The POD basis must be computed before the system is projected.");
+  }
+
+  mfem::DenseMatrix mass_basis(_basis.Height(), BasisSize());
+  mfem::DenseMatrix stiffness_basis(_basis.Height(), BasisSize());
+  mfem::Vector column, product;
+  for (int j = 0; j < BasisSize(); ++j)
+  {
+    _basis.GetColumnReference(j, column);
+    mass_basis.GetColumnReference(j, product);
+    mass.Mult(column, product);
+    stiffness_basis.GetColumnReference(j, product);
+    stiffness.Mult(column, product);
+  }
+
+  SetReducedSystem(mass_basis, stiffness_basis, load);
+}
+
+void
+PODReducedOrderModel::SetReducedSystem(const mfem::DenseMatrix & mass_basis,
+                                       const mfem::DenseMatrix & stiffness_basis,
+                                       const mfem::Vector & load)
+{
+  const int size = BasisSize();
+
+  _reduced_mass.SetSize(size);
+  mfem::MultAtB(_basis, mass_basis, _reduced_mass);
+  AllreduceSum(_comm, _reduced_mass);
+
+  _reduced_stiffness.SetSize(size);
+  mfem::MultAtB(_basis, stiffness_basis, _reduced_stiffness);
+  AllreduceSum(_comm, _reduced_stiffness);
+
+  Restrict(load, _reduced_load);
+
+  mfem::DenseMatrix residual_basis(_basis.Height(), 2 * size + 1);
+  residual_basis.SetCol(0, load);
+  residual_basis.CopyMN(mass_basis, 0, 1);
+  residual_basis.CopyMN(stiffness_basis, 0, size + 1);
+
+  _residual_gram.SetSize(2 * size + 1);
+  mfem::MultAtB(residual_basis, residual_basis, _residual_gram);
+  AllreduceSum(_comm, _residual_gram);
+
+  _projected = true;
+}
+
+void
+PODReducedOrderModel::Integrate(double dt,
+                                const mfem::Vector & waveform,
+                                const mfem::Vector & initial_state,
+                                mfem::DenseMatrix & states,
+                                mfem::Vector & indicators) const
+{
+  if (!_projected)
+  {
+    MFEM_ABORT("The POD system must be projected before it is integrated.");
+  }
+
+  const int size = BasisSize();
+  const int num_steps = waveform.Size();
+
+  mfem::DenseMatrix step_matrix(_reduced_mass);
+  step_matrix.Add(dt, _reduced_stiffness);
+  mfem::DenseMatrixInverse step_solver(step_matrix);
+
+  states.SetSize(size, num_steps + 1);
+  states.SetCol(0, initial_state);
+  indicators.SetSize(num_steps);
+
+  mfem::Vector state(initial_state), rate(size), rhs(size);
+  mfem::Vector residual_coefficients(2 * size + 1), gram_product(2 * size + 1);
+  const double load_norm = waveform.Normlinf() * sqrt(_residual_gram(0, 0));
+
+  for (int n = 0; n < num_steps; ++n)
+  {
+    rhs.Set(waveform(n), _reduced_load);
+    _reduced_stiffness.AddMult_a(-1.0, state, rhs);
+    step_solver.Mult(rhs, rate);
+
+    state.Add(dt, rate);
+    states.SetCol(n + 1, state);
+
+    // The full order residual w f - M V da/dt - K V a at the end of the step is orthogonal to the
+    // basis. Its norm is found from the inner products of its terms, to within round-off of order
+    // sqrt(eps) |w f|.
+    residual_coefficients(0) = waveform(n);
+    for (int i = 0; i < size; ++i)
+    {
+      residual_coefficients(i + 1) = -rate(i);
+      residual_coefficients(i + size + 1) = -state(i);
+    }
+    _residual_gram.Mult(residual_coefficients, gram_product);
+    const double residual_norm = sqrt(std::max(residual_coefficients * gram_product, 0.0));
+    indicators(n) = load_norm > 0.0 ? residual_norm / load_norm : residual_norm;
+  }
+}
+
+void
+PODReducedOrderModel::Restrict(const mfem::Vector & true_state, mfem::Vector & reduced_state) const
+{
+  reduced_state.SetSize(BasisSize());
+  _basis.MultTranspose(true_state, reduced_state);
+  MPI_Allreduce(
+      MPI_IN_PLACE, reduced_state.GetData(), BasisSize(), MPI_DOUBLE, MPI_SUM, _comm);
+}
+
+void
+PODReducedOrderModel::Reconstruct(const mfem::Vector & reduced_state,
+                                  mfem::Vector & true_state) const
+{
+  true_state.SetSize(_basis.Height());
+  _basis.Mult(reduced_state, true_state);
+}
+
+void
+PODReducedOrderModel::UpdateTruncationError()
+{
+  // |u - V V^T u|^2 = |u|^2 - |V^T u|^2 for an orthonormal basis.
+  mfem::DenseMatrix coefficients(BasisSize(), NumSnapshots());
+  mfem::Vector column;
+  double snapshot_norm = 0.0;
+  for (int j = 0; j < NumSnapshots(); ++j)
+  {
+    coefficients.GetColumnReference(j, column);
+    _basis.MultTranspose(_snapshots[j], column);
+    snapshot_norm += _snapshots[j] * _snapshots[j];
+  }
+  AllreduceSum(_comm, coefficients);
+  MPI_Allreduce(MPI_IN_PLACE, &snapshot_norm, 1, MPI_DOUBLE, MPI_SUM, _comm);
+
+  const double captured_norm = coefficients.FNorm2();
+  _truncation_error =
+      snapshot_norm > 0.0 ? sqrt(std::max(snapshot_norm - captured_norm, 0.0) / snapshot_norm)
+                          : 0.0;
+}
+
+PODSnapshotAux::PODSnapshotAux(std::shared_ptr<hephaestus::PODReducedOrderModel> rom,
+                               std::vector<std::string> gridfunction_names)
+  : _rom(std::move(rom)), _gridfunction_names(std::move(gridfunction_names))
+{
+}
+
+void
+PODSnapshotAux::Init(const hephaestus::GridFunctions & gridfunctions,
+                     hephaestus::Coefficients & coefficients)
+{
+  _gridfunctions = gridfunctions.Get(_gridfunction_names);
+}
+
+void
+PODSnapshotAux::Solve(double t)
+{
+  int size = 0;
+  for (auto * gridfunction : _gridfunctions)
+  {
+    size += gridfunction->ParFESpace()->TrueVSize();
+  }
+  _true_state.SetSize(size);
+
+  int offset = 0;
+  mfem::Vector block;
+  for (auto * gridfunction : _gridfunctions)
+  {
+    block.MakeRef(_true_state, offset, gridfunction->ParFESpace()->TrueVSize());
+    gridfunction->ParallelProject(block);
+    offset += block.Size();
+  }
+
+  _rom->AddSnapshot(_true_state);
+}
+
+} // namespace hephaestus
@@ -0,0 +1,156 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "auxsolver_base.hpp"
+#include "inputs.hpp"
+#include "time_domain_equation_system_problem_operator.hpp"
+
+namespace hephaestus
+{
+
+/// Computes the leading left singular vectors of the matrix whose columns are @a snapshots, by a
+/// randomised range finder with @a power_iterations subspace iterations. Rows of the snapshots are
+/// distributed over the ranks of @a comm; each rank receives its rows of @a basis. At most @a rank
+/// vectors are returned, fewer if the snapshots are rank-deficient. The random sketch is seeded
+/// by @a seed, so every rank draws the same sketch.
+void ComputeRandomisedSVD(MPI_Comm comm,
+                          const std::vector<mfem::Vector> & snapshots,
+                          int rank,
+                          int oversampling,
+                          int power_iterations,
+                          unsigned int seed,
+                          mfem::DenseMatrix & basis,
+                          mfem::Vector & singular_values);
+
+/// Proper orthogonal decomposition reduced-order model for linear transient problems of the form
+///
+/// M du/dt + K u = w(t) f
+///
+/// whose implicit step assembles (M + dt K) du/dt = w(t) f - K u, as the eddy current
+/// formulations do with linear materials. The load f has a fixed spatial distribution, scaled by
+/// the drive waveform w(t).
+///
+/// Offline, snapshots of the true DOF state are collected from full order runs (see
+/// PODSnapshotAux), compressed into an orthonormal basis V, and the assembled operators are
+/// projected onto it. Online, the dense reduced system
+///
+/// (V^T M V) da/dt + (V^T K V) a = w(t) V^T f
+///
+/// is integrated by backward Euler for new waveforms at negligible cost, with u ≈ V a. The residual
+/// of the full order system at the reduced solution is evaluated from precomputed inner products,
+/// to indicate when the basis should be enriched with snapshots of a further full order run.
+class PODReducedOrderModel
+{
+public:
+  explicit PODReducedOrderModel(const hephaestus::InputParameters & params);
+
+  ~PODReducedOrderModel() = default;
+
+  /// Adds a snapshot of the true DOF state. All snapshots must share a layout.
+  void AddSnapshot(const mfem::Vector & true_state);
+
+  /// Compresses all snapshots into a basis of at most "BasisSize" vectors.
+  void ComputeBasis();
+
+  /// Extends the basis with the part of the snapshots added since the last call to ComputeBasis or
+  /// Enrich that it does not capture. Directions with singular values below
+  /// "EnrichmentTolerance" relative to the leading singular value are discarded. Returns the number
+  /// of basis vectors added. The reduced system must be projected again afterwards.
+  int Enrich();
+
+  /// Projects the system of @a problem_operator onto the basis, from two assemblies of its implicit
+  /// step at time step sizes of @a dt and 2 @a dt. The load f is taken from the sources at the
+  /// operator's current time. Essential BCs must be homogeneous.
+  void Project(hephaestus::TimeDomainEquationSystemProblemOperator & problem_operator, double dt);
+
+  /// Projects a system with separately assembled operators and load onto the basis.
+  void Project(const mfem::Operator & mass,
+               const mfem::Operator & stiffness,
+               const mfem::Vector & load);
+
+  /// Integrates the reduced system by backward Euler with steps of @a dt from the reduced
+  /// state @a initial_state. Entry n of @a waveform is w at the end of step n. Column n of
+  /// @a states is the reduced state after n steps. Entry n of @a indicators is the norm of the
+  /// full order residual of step n, relative to the largest load of the waveform.
+  void Integrate(double dt,
+                 const mfem::Vector & waveform,
+                 const mfem::Vector & initial_state,
+                 mfem::DenseMatrix & states,
+                 mfem::Vector & indicators) const;
+
+  /// Returns the reduced state V^T u of the true DOF state @a true_state.
+  void Restrict(const mfem::Vector & true_state, mfem::Vector & reduced_state) const;
+
+  /// Returns the true DOF state V a of the reduced state @a reduced_state.
+  void Reconstruct(const mfem::Vector & reduced_state, mfem::Vector & true_state) const;
+
+  [[nodiscard]] int BasisSize() const { return _basis.Width(); }
+
+  [[nodiscard]] int NumSnapshots() const { return static_cast<int>(_snapshots.size()); }
+
+  [[nodiscard]] const mfem::DenseMatrix & GetBasis() const { return _basis; }
+
+  /// Returns the singular value of each basis vector: of the snapshots for the vectors from
+  /// ComputeBasis, and of the part of the new snapshots outside the basis for those from Enrich.
+  [[nodiscard]] const mfem::Vector & GetSingularValues() const { return _singular_values; }
+
+  /// Returns the projection error of the snapshots onto the basis, relative to their norm, as
+  /// sqrt(sum |u_i - V V^T u_i|^2 / sum |u_i|^2).
+  [[nodiscard]] double TruncationError() const { return _truncation_error; }
+
+private:
+  // Projects the operators applied to the basis, and the load, and forms the inner products for
+  // the residual indicator.
+  void SetReducedSystem(const mfem::DenseMatrix & mass_basis,
+                        const mfem::DenseMatrix & stiffness_basis,
+                        const mfem::Vector & load);
+
+  void UpdateTruncationError();
+
+  MPI_Comm _comm;
+  int _basis_size;
+  int _oversampling;
+  int _power_iterations;
+  double _enrichment_tol;
+  unsigned int _seed;
+
+  std::vector<mfem::Vector> _snapshots;
+  // Number of snapshots captured by the basis; later snapshots are used by Enrich.
+  std::size_t _num_compressed{0};
+
+  mfem::DenseMatrix _basis;
+  mfem::Vector _singular_values;
+  double _truncation_error{0.0};
+
+  // Reduced system.
+  bool _projected{false};
+  mfem::DenseMatrix _reduced_mass, _reduced_stiffness;
+  mfem::Vector _reduced_load;
+
+  // Inner products of [f, M V, K V], from which the norm of the full order residual
+  // w f - M V da/dt - K V a is found.
+  mfem::DenseMatrix _residual_gram;
+};
+
+/// Adds a snapshot of the true DOFs of the given gridfunctions to a POD model on each solve. List
+/// the trial variables of the equation system in order, to match the layout of its operators.
+class PODSnapshotAux : public AuxSolver
+{
+public:
+  PODSnapshotAux(std::shared_ptr<hephaestus::PODReducedOrderModel> rom,
+                 std::vector<std::string> gridfunction_names);
+
+  ~PODSnapshotAux() override = default;
+
+  void Init(const hephaestus::GridFunctions & gridfunctions,
+            hephaestus::Coefficients & coefficients) override;
+
+  void Solve(double t = 0.0) override;
+
+private:
+  std::shared_ptr<hephaestus::PODReducedOrderModel> _rom{nullptr};
+  std::vector<std::string> _gridfunction_names;
+  std::vector<mfem::ParGridFunction *> _gridfunctions;
+  mfem::Vector _true_state;
+};
+
+} // namespace hephaestus
@@ -0,0 +1,298 @@
+#include "autotune_solver.hpp"
+#include "linear_tolerance_policy.hpp"
+
+#include <sstream>
+#include <utility>
+
+namespace hephaestus
+{
+
+AutotuneSolver::AutotuneSolver(MPI_Comm comm,
+                               std::string record_path,
+                               double acceptance_tol,
+                               int solves_per_setup)
+  : _comm(comm),
+    _record_path(std::move(record_path)),
+    _acceptance_tol(acceptance_tol),
+    _solves_per_setup(std::max(solves_per_setup, 1))
+{
+  MPI_Comm_rank(_comm, &_myid);
+}
+
+void
+AutotuneSolver::AddCandidate(std::string name,
+                             std::shared_ptr<mfem::Solver> solver,
+                             std::shared_ptr<mfem::Solver> preconditioner)
+{
+  if (IsTuned())
+  {
+    MFEM_ABORT("Cannot add autotune candidate '" << name << "' after a selection has been made.");
+  }
+
+  Candidate candidate;
+  candidate._name = std::move(name);
+  candidate._solver = std::move(solver);
+  candidate._preconditioner = std::move(preconditioner);
+
+  _candidates.push_back(std::move(candidate));
+}
+
+std::string
+AutotuneSolver::GetSelectedName() const
+{
+  return IsTuned() ? _candidates.at(_selected)._name : std::string();
+}
+
+bool
+AutotuneSolver::SetRelativeTolerance(double tolerance)
+{
+  if (IsTuned())
+  {
+    return LinearTolerancePolicy::SetRelativeTolerance(*_candidates.at(_selected)._solver,
+                                                       tolerance);
+  }
+
+  bool tolerance_set = false;
+  for (auto & candidate : _candidates)
+  {
+    tolerance_set =
+        LinearTolerancePolicy::SetRelativeTolerance(*candidate._solver, tolerance) || tolerance_set;
+  }
+
+  return tolerance_set;
+}
+
+void
+AutotuneSolver::SetOperator(const mfem::Operator & op)
+{
+  height = op.Height();
+  width = op.Width();
+  _op = &op;
+
+  if (_candidates.empty())
+  {
+    MFEM_ABORT("AutotuneSolver has no candidates.");
+  }
+
+  // Look for a previous selection for this model.
+  if (!IsTuned() && !_record_path.empty())
+  {
+    const std::string recorded_name = ReadRecord();
+    for (size_t i = 0; i < _candidates.size(); ++i)
+    {
+      if (_candidates[i]._name == recorded_name)
+      {
+        logger.info("Autotune: using recorded solver configuration '{}'", recorded_name);
+        Select(static_cast<int>(i));
+        break;
+      }
+    }
+  }
+
+  if (IsTuned())
+  {
+    _candidates.at(_selected)._solver->SetOperator(op);
+  }
+}
+
+void
+AutotuneSolver::Mult(const mfem::Vector & b, mfem::Vector & x) const
+{
+  if (_op == nullptr)
+  {
+    MFEM_ABORT("AutotuneSolver::SetOperator must be called before Mult.");
+  }
+
+  if (IsTuned())
+  {
+    auto & solver = *_candidates.at(_selected)._solver;
+    solver.iterative_mode = iterative_mode;
+    solver.Mult(b, x);
+    return;
+  }
+
+  Tune(b, x);
+}
+
+void
+AutotuneSolver::Tune(const mfem::Vector & b, mfem::Vector & x) const
+{
+  // Every candidate starts from the same initial guess as the wrapped solve would.
+  mfem::Vector guess(x.Size());
+  if (iterative_mode)
+  {
+    guess = x;
+  }
+  else
+  {
+    guess = 0.0;
+  }
+
+  mfem::Vector trial(x.Size());
+  mfem::Vector best(x.Size());
+  mfem::Vector closest(x.Size());
+  mfem::Vector residual(b.Size());
+
+  const double b_norm = mfem::ParNormlp(b, 2, _comm);
+
+  int best_index = -1;
+  double best_cost = std::numeric_limits<double>::max();
+  int closest_index = -1;
+
+  for (size_t i = 0; i < _candidates.size(); ++i)
+  {
+    auto & candidate = _candidates[i];
+    candidate._solver->iterative_mode = true;
+
+    // First solve includes the (lazy) setup of hypre solvers and preconditioners.
+    MPI_Barrier(_comm);
+    double start = MPI_Wtime();
+    candidate._solver->SetOperator(*_op);
+    trial = guess;
+    candidate._solver->Mult(b, trial);
+    MPI_Barrier(_comm);
+    const double first_solve = MPI_Wtime() - start;
+
+    // Repeat solve with the setup already done.
+    start = MPI_Wtime();
+    trial = guess;
+    candidate._solver->Mult(b, trial);
+    MPI_Barrier(_comm);
+    candidate._solve_time = MPI_Wtime() - start;
+    candidate._setup_time = std::max(first_solve - candidate._solve_time, 0.0);
+
+    _op->Mult(trial, residual);
+    residual -= b;
+    const double r_norm = mfem::ParNormlp(residual, 2, _comm);
+    candidate._relative_residual = (b_norm > 0.0) ? r_norm / b_norm : r_norm;
+    candidate._accepted = std::isfinite(candidate._relative_residual) &&
+                          candidate._relative_residual <= _acceptance_tol;
+
+    const double cost = candidate._setup_time + _solves_per_setup * candidate._solve_time;
+
+    logger.info("Autotune: candidate '{}': setup {:.3e} s, solve {:.3e} s, residual {:.3e}{}",
+                candidate._name,
+                candidate._setup_time,
+                candidate._solve_time,
+                candidate._relative_residual,
+                candidate._accepted ? "" : " (rejected)");
+
+    if (candidate._accepted && cost < best_cost)
+    {
+      best_cost = cost;
+      best_index = static_cast<int>(i);
+      best = trial;
+    }
+
+    // Kept in case no candidate is accepted.
+    if (closest_index < 0 ||
+        candidate._relative_residual < _candidates[closest_index]._relative_residual)
+    {
+      closest_index = static_cast<int>(i);
+      closest = trial;
+    }
+  }
+
+  if (best_index < 0)
+  {
+    // Nothing met the acceptance tolerance: fall back to the smallest residual.
+    best_index = closest_index;
+    best = closest;
+    logger.warn("Autotune: no candidate met the acceptance tolerance {:.1e}; using '{}'",
+                _acceptance_tol,
+                _candidates[best_index]._name);
+  }
+
+  logger.info("Autotune: selected '{}'", _candidates[best_index]._name);
+
+  if (!_record_path.empty())
+  {
+    WriteRecord(best_index);
+  }
+
+  // The selected solver was set up on the current operator during tuning.
+  Select(best_index);
+
+  x = best;
+}
+
+void
+AutotuneSolver::Select(int index) const
+{
+  _selected = index;
+
+  if (_preconditioner_handle != nullptr)
+  {
+    *_preconditioner_handle = _candidates[_selected]._preconditioner;
+  }
+
+  // Release the candidates that were not chosen, along with their preconditioner hierarchies.
+  for (size_t i = 0; i < _candidates.size(); ++i)
+  {
+    if (static_cast<int>(i) != _selected)
+    {
+      _candidates[i]._solver.reset();
+      _candidates[i]._preconditioner.reset();
+    }
+  }
+}
+
+std::string
+AutotuneSolver::ReadRecord() const
+{
+  // Read on the root rank and broadcast, so that all ranks make the same choice.
+  std::string name;
+  if (_myid == 0)
+  {
+    std::ifstream record(_record_path);
+    std::string line;
+    while (record && std::getline(record, line))
+    {
+      std::istringstream tokens(line);
+      std::string key;
+      if (tokens >> key && key == "selected")
+      {
+        tokens >> name;
+        break;
+      }
+    }
+  }
+
+  int length = static_cast<int>(name.size());
+  MPI_Bcast(&length, 1, MPI_INT, 0, _comm);
+  name.resize(length);
+  MPI_Bcast(name.data(), length, MPI_CHAR, 0, _comm);
+
+  return name;
+}
+
+void
+AutotuneSolver::WriteRecord(int selected) const
+{
+  if (_myid != 0)
+  {
+    return;
+  }
+
+  std::ofstream record(_record_path);
+  if (!record)
+  {
+    logger.warn("Autotune: unable to write record file '{}'", _record_path);
+    return;
+  }
+
+  int num_procs;
+  MPI_Comm_size(_comm, &num_procs);
+
+  record << "# Solver autotune record (" << num_procs << " ranks)\n";
+  for (const auto & candidate : _candidates)
+  {
+    record << "candidate " << candidate._name << " " << candidate._setup_time << " "
+           << candidate._solve_time << " " << candidate._relative_residual << " "
+           << candidate._accepted << "\n";
+  }
+
+  record << "selected " << _candidates.at(selected)._name << "\n";
+}
+
+} // namespace hephaestus
@@ -0,0 +1,87 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "logging.hpp"
+
+namespace hephaestus
+{
+
+/// Selects the fastest of a set of candidate solver/preconditioner configurations on the first
+/// solve, using the actual Jacobian and right-hand side.
+///
+/// Each candidate is timed on the first solve. The setup cost is estimated as the first solve's
+/// time minus the time of a repeat solve. Candidates are ranked by setup + n * solve time, where
+/// n is the expected number of solves per setup. Only candidates whose true relative residual is
+/// below the acceptance tolerance count. The winner is used for all later solves and the other
+/// candidates are released. Candidates start from the initial guess of the wrapped solve, and
+/// later solves forward iterative_mode to the winner. If a record file is given, the choice is
+/// written to it, and later runs that find a matching record skip tuning.
+class AutotuneSolver : public mfem::Solver
+{
+public:
+  AutotuneSolver(MPI_Comm comm,
+                 std::string record_path = "",
+                 double acceptance_tol = 1.0e-8,
+                 int solves_per_setup = 1);
+
+  ~AutotuneSolver() override = default;
+
+  void AddCandidate(std::string name,
+                    std::shared_ptr<mfem::Solver> solver,
+                    std::shared_ptr<mfem::Solver> preconditioner = nullptr);
+
+  /// Points @a handle at the preconditioner of the selected candidate once a selection is made.
+  /// The handle must outlive the solver.
+  void SetPreconditionerHandle(std::shared_ptr<mfem::Solver> * handle)
+  {
+    _preconditioner_handle = handle;
+  }
+
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & b, mfem::Vector & x) const override;
+
+  /// Sets the relative tolerance of the selected candidate, or of every candidate before a
+  /// selection is made. Returns false if no tolerance could be changed.
+  bool SetRelativeTolerance(double tolerance);
+
+  /// Returns true once a candidate has been selected (by tuning or from the record file).
+  [[nodiscard]] bool IsTuned() const { return _selected >= 0; }
+
+  /// Returns the name of the selected candidate, or an empty string if not yet tuned.
+  [[nodiscard]] std::string GetSelectedName() const;
+
+private:
+  struct Candidate
+  {
+    std::string _name;
+    std::shared_ptr<mfem::Solver> _solver;
+    std::shared_ptr<mfem::Solver> _preconditioner;
+
+    double _setup_time{0.0};
+    double _solve_time{0.0};
+    double _relative_residual{0.0};
+    bool _accepted{false};
+  };
+
+  void Tune(const mfem::Vector & b, mfem::Vector & x) const;
+  void Select(int index) const;
+
+  [[nodiscard]] std::string ReadRecord() const;
+  void WriteRecord(int selected) const;
+
+  MPI_Comm _comm;
+  int _myid{0};
+
+  std::string _record_path;
+  double _acceptance_tol;
+  int _solves_per_setup;
+
+  mutable std::vector<Candidate> _candidates;
+  mutable int _selected{-1};
+
+  const mfem::Operator * _op{nullptr};
+
+  std::shared_ptr<mfem::Solver> * _preconditioner_handle{nullptr};
+};
+
+} // namespace hephaestus
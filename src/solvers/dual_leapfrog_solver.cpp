@@ -0,0 +1,371 @@
+#include "dual_leapfrog_solver.hpp"
+#include "utils.hpp"
+
+namespace hephaestus
+{
+
+DualLeapfrogSolver::DualLeapfrogSolver(const hephaestus::InputParameters & params,
+                                       hephaestus::Problem & problem)
+  : _problem(problem),
+    _permittivity_coef_name(params.GetOptionalParam<std::string>("PermittivityCoefName",
+                                                                 "dielectric_permittivity")),
+    _chebyshev_iterations(params.GetOptionalParam<int>("ChebyshevIterations", 16))
+{
+  if (_chebyshev_iterations < 1)
+  {
+    MFEM_ABORT("DualLeapfrogSolver requires at least 1 Chebyshev iteration.");
+  }
+}
+
+void
+DualLeapfrogSolver::Init(mfem::TimeDependentOperator & f)
+{
+  mfem::ODESolver::Init(f);
+
+  _dual_operator = dynamic_cast<hephaestus::DualOperator *>(&f);
+  if (_dual_operator == nullptr)
+  {
+    MFEM_ABORT("DualLeapfrogSolver requires a DualOperator.");
+  }
+  auto * equation_system =
+      dynamic_cast<hephaestus::WeakCurlEquationSystem *>(_dual_operator->GetEquationSystem());
+  if (equation_system == nullptr)
+  {
+    MFEM_ABORT("DualLeapfrogSolver requires a DualOperator with a WeakCurlEquationSystem.");
+  }
+
+  hephaestus::Coefficients & coefficients = _problem._coefficients;
+  if (!coefficients._scalars.Has(_permittivity_coef_name))
+  {
+    MFEM_ABORT(_permittivity_coef_name + " coefficient not found.");
+  }
+  _permittivity = coefficients._scalars.Get(_permittivity_coef_name);
+  _conductivity = coefficients._scalars.Get(equation_system->_beta_coef_name);
+  _reluctivity = coefficients._scalars.Get(equation_system->_alpha_coef_name);
+
+  _e_field = _dual_operator->_u;
+  _db_dt = _dual_operator->_dv;
+  _b_field = _problem._gridfunctions.Get(_dual_operator->_h_div_var_name);
+  _de_dt = _problem._gridfunctions.Get(GetTimeDerivativeName(_dual_operator->_h_curl_var_name));
+
+  _bc_values = std::make_unique<mfem::ParGridFunction>(_dual_operator->_h_curl_fe_space);
+  _load_lf.reset();
+
+  _curl.reset();
+  _step_mass.reset();
+  _dt = 0.0;
+}
+
+void
+DualLeapfrogSolver::BuildOperators(double dt)
+{
+  spdlog::stopwatch sw;
+
+  mfem::ParFiniteElementSpace * h_curl_fe_space = _dual_operator->_h_curl_fe_space;
+  mfem::ParFiniteElementSpace * h_div_fe_space = _dual_operator->_h_div_fe_space;
+
+  // Operators independent of the time step.
+  if (!_curl)
+  {
+    _curl.reset(_dual_operator->GetCurl().ParallelAssemble());
+
+    // (νB, ∇×E')
+    mfem::ParMixedBilinearForm weak_curl(h_curl_fe_space, h_div_fe_space);
+    weak_curl.AddDomainIntegrator(new mfem::VectorFECurlIntegrator(*_reluctivity));
+    weak_curl.Assemble();
+    weak_curl.Finalize();
+    _weak_curl.reset(weak_curl.ParallelAssemble());
+
+    // (σE, E')
+    mfem::ParBilinearForm conductivity_mass(h_curl_fe_space);
+    conductivity_mass.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_conductivity));
+    conductivity_mass.Assemble();
+    conductivity_mass.Finalize();
+    _conductivity_mass.reset(conductivity_mass.ParallelAssemble());
+  }
+
+  // (εE, E') + (h/2 σE, E')
+  mfem::ProductCoefficient half_dt_conductivity(0.5 * dt, *_conductivity);
+  mfem::ParBilinearForm step_mass(h_curl_fe_space);
+  step_mass.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(*_permittivity));
+  step_mass.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(half_dt_conductivity));
+  step_mass.Assemble();
+  step_mass.Finalize();
+  _step_mass.reset(step_mass.ParallelAssemble());
+
+  _problem._bc_map.GetEssentialTrueDofs(_dual_operator->_h_curl_var_name,
+                                        _ess_tdof_list,
+                                        *h_curl_fe_space,
+                                        h_curl_fe_space->GetParMesh());
+  _step_mass_eliminated.reset(_step_mass->EliminateRowsCols(_ess_tdof_list));
+
+  _step_mass->GetDiag(_inverse_diagonal);
+  for (int i = 0; i < _inverse_diagonal.Size(); ++i)
+  {
+    _inverse_diagonal(i) = 1.0 / _inverse_diagonal(i);
+  }
+  _dt = dt;
+
+  EstimateMassBounds();
+  const double stable_dt = EstimateStableTimeStep();
+  if (dt > stable_dt)
+  {
+    logger.warn("DualLeapfrogSolver: time step {} exceeds the estimated stability limit {}",
+                dt,
+                stable_dt);
+  }
+
+  logger.info("{} BuildOperators: mass spectrum [{}, {}], stable time step {}, {} seconds",
+              typeid(this).name(),
+              _lambda_min,
+              _lambda_max,
+              stable_dt,
+              sw);
+}
+
+void
+DualLeapfrogSolver::AssembleLoad(double t, mfem::Vector & load)
+{
+  mfem::ParFiniteElementSpace * h_curl_fe_space = _dual_operator->_h_curl_fe_space;
+
+  _problem._coefficients.SetTime(t);
+
+  // Each application of the integrated BCs adds integrators to the form, so they are added once
+  // and again to a new form only if the BCs change.
+  if (_load_lf == nullptr || _load_lf_bc_revision != _problem._bc_map.GetRevision())
+  {
+    _load_lf = std::make_unique<mfem::ParLinearForm>(h_curl_fe_space);
+    _problem._bc_map.ApplyIntegratedBCs(
+        _dual_operator->_h_curl_var_name, *_load_lf, h_curl_fe_space->GetParMesh());
+    _load_lf_bc_revision = _problem._bc_map.GetRevision();
+  }
+  _load_lf->Assemble();
+  _problem._sources.Apply(_load_lf.get());
+
+  load.SetSize(h_curl_fe_space->GetTrueVSize());
+  _load_lf->ParallelAssemble(load);
+}
+
+void
+DualLeapfrogSolver::AssembleBoundaryValues(double t, mfem::Vector & values)
+{
+  _problem._coefficients.SetTime(t);
+  *_bc_values = 0.0;
+  _problem._bc_map.ApplyEssentialBCs(_dual_operator->_h_curl_var_name,
+                                     _ess_tdof_list,
+                                     *_bc_values,
+                                     _bc_values->ParFESpace()->GetParMesh());
+
+  values.SetSize(_bc_values->ParFESpace()->GetTrueVSize());
+  _bc_values->ParallelProject(values);
+}
+
+void
+DualLeapfrogSolver::ApplyMassInverse(const mfem::Vector & rhs, mfem::Vector & x) const
+{
+  // Chebyshev iteration for the Jacobi-preconditioned system with spectrum in
+  // [θ - δ, θ + δ], from a zero initial guess. No inner products are needed.
+  const double theta = 0.5 * (_lambda_max + _lambda_min);
+  const double delta = 0.5 * (_lambda_max - _lambda_min);
+
+  auto & scratch = _problem._scratch;
+  auto & residual = scratch.GetVector("DualLeapfrogSolver::residual", rhs.Size());
+  auto & preconditioned = scratch.GetVector("DualLeapfrogSolver::preconditioned", rhs.Size());
+  auto & direction = scratch.GetVector("DualLeapfrogSolver::direction", rhs.Size());
+  auto & product = scratch.GetVector("DualLeapfrogSolver::product", rhs.Size());
+  residual = rhs;
+  preconditioned = rhs;
+  preconditioned *= _inverse_diagonal;
+
+  x.SetSize(rhs.Size());
+  x = 0.0;
+  if (delta <= 1.0e-12 * theta)
+  {
+    x.Add(1.0 / theta, preconditioned);
+    return;
+  }
+
+  const double sigma = theta / delta;
+  double rho = 1.0 / sigma;
+  direction.Set(1.0 / theta, preconditioned);
+
+  for (int k = 0; k < _chebyshev_iterations; ++k)
+  {
+    x += direction;
+    if (k == _chebyshev_iterations - 1)
+    {
+      break;
+    }
+
+    _step_mass->Mult(direction, product);
+    residual -= product;
+    preconditioned = residual;
+    preconditioned *= _inverse_diagonal;
+
+    const double rho_next = 1.0 / (2.0 * sigma - rho);
+    direction *= rho_next * rho;
+    direction.Add(2.0 * rho_next / delta, preconditioned);
+    rho = rho_next;
+  }
+}
+
+void
+DualLeapfrogSolver::EstimateMassBounds()
+{
+  // Lanczos iterations on D^(-1/2) A D^(-1/2). Ritz values lie inside the spectrum and the largest
+  // converges quickly; it is enlarged, since the Chebyshev iteration diverges for eigenvalues
+  // above the upper bound. An overestimated lower bound only slows convergence of the lowest
+  // modes.
+  const int max_steps = 20;
+  const MPI_Comm comm = _step_mass->GetComm();
+  const int size = _inverse_diagonal.Size();
+
+  mfem::Vector scaling(size);
+  for (int i = 0; i < size; ++i)
+  {
+    scaling(i) = sqrt(_inverse_diagonal(i));
+  }
+
+  mfem::Vector q(size), q_previous(size), w(size), scaled(size);
+  q.Randomize(1);
+  q /= sqrt(mfem::InnerProduct(comm, q, q));
+  q_previous = 0.0;
+
+  mfem::DenseMatrix tridiagonal(max_steps);
+  tridiagonal = 0.0;
+  double beta = 0.0;
+  int steps = 0;
+  for (int j = 0; j < max_steps; ++j)
+  {
+    scaled = q;
+    scaled *= scaling;
+    _step_mass->Mult(scaled, w);
+    w *= scaling;
+
+    const double alpha = mfem::InnerProduct(comm, q, w);
+    w.Add(-alpha, q);
+    w.Add(-beta, q_previous);
+    tridiagonal(j, j) = alpha;
+    steps = j + 1;
+
+    beta = sqrt(mfem::InnerProduct(comm, w, w));
+    if (j + 1 == max_steps || beta <= 1.0e-12 * fabs(alpha))
+    {
+      break;
+    }
+    tridiagonal(j, j + 1) = tridiagonal(j + 1, j) = beta;
+
+    q_previous = q;
+    q.Set(1.0 / beta, w);
+  }
+
+  mfem::DenseMatrix ritz_matrix;
+  ritz_matrix.CopyMN(tridiagonal, steps, steps, 0, 0);
+  mfem::Vector ritz_values;
+  mfem::DenseMatrix ritz_vectors;
+  SymmetricEigensystem(ritz_matrix, ritz_values, ritz_vectors);
+
+  _lambda_max = 1.1 * ritz_values(0);
+  _lambda_min = std::min(ritz_values(steps - 1), _lambda_max);
+}
+
+double
+DualLeapfrogSolver::EstimateStableTimeStep() const
+{
+  // Power iterations for the largest eigenvalue ω² of (M_ε + h/2 M_σ)⁻¹ Wᵀ C. The Störmer-Verlet
+  // step is stable for h ω < 2.
+  const int iterations = 20;
+  const MPI_Comm comm = _step_mass->GetComm();
+
+  mfem::Vector v(_curl->Width()), curl_v(_curl->Height()), curl_curl_v(_curl->Width());
+  v.Randomize(1);
+
+  double omega_squared = 0.0;
+  for (int k = 0; k < iterations; ++k)
+  {
+    v.SetSubVector(_ess_tdof_list, 0.0);
+    const double norm = sqrt(mfem::InnerProduct(comm, v, v));
+    if (norm == 0.0)
+    {
+      break;
+    }
+    v /= norm;
+
+    _curl->Mult(v, curl_v);
+    _weak_curl->MultTranspose(curl_v, curl_curl_v);
+    curl_curl_v.SetSubVector(_ess_tdof_list, 0.0);
+    ApplyMassInverse(curl_curl_v, v);
+    omega_squared = sqrt(mfem::InnerProduct(comm, v, v));
+  }
+
+  // Power iterations approach ω² from below.
+  return (omega_squared > 0.0) ? 0.9 * 2.0 / sqrt(omega_squared)
+                               : std::numeric_limits<double>::infinity();
+}
+
+void
+DualLeapfrogSolver::Step(mfem::Vector & x, double & t, double & dt)
+{
+  spdlog::stopwatch sw;
+
+  if (!_step_mass || fabs(dt - _dt) > 1.0e-12 * dt)
+  {
+    BuildOperators(dt);
+  }
+
+  // Temporaries are taken from the scratch pool, so that a step allocates nothing.
+  auto & scratch = _problem._scratch;
+  auto & e = scratch.GetVector("DualLeapfrogSolver::e", _curl->Width());
+  auto & b = scratch.GetVector("DualLeapfrogSolver::b", _curl->Height());
+  auto & curl_e = scratch.GetVector("DualLeapfrogSolver::curl_e", _curl->Height());
+  _e_field->ParallelProject(e);
+  _b_field->ParallelProject(b);
+
+  // First half step of B.
+  _curl->Mult(e, curl_e);
+  b.Add(-0.5 * dt, curl_e);
+
+  // Step of E, with the increment on essential DOFs set by the BCs at the end of the step.
+  auto & rhs = scratch.GetVector("DualLeapfrogSolver::rhs", e.Size());
+  auto & bc_values = scratch.GetVector("DualLeapfrogSolver::bc_values", e.Size());
+  auto & increment = scratch.GetVector("DualLeapfrogSolver::increment", e.Size());
+  AssembleLoad(t + 0.5 * dt, rhs);
+  _weak_curl->MultTranspose(1.0, b, 1.0, rhs);
+  _conductivity_mass->Mult(-1.0, e, 1.0, rhs);
+  rhs *= dt;
+
+  AssembleBoundaryValues(t + dt, bc_values);
+  increment = 0.0;
+  for (int i = 0; i < _ess_tdof_list.Size(); ++i)
+  {
+    const int dof = _ess_tdof_list[i];
+    increment(dof) = bc_values(dof) - e(dof);
+  }
+  _step_mass->EliminateBC(*_step_mass_eliminated, _ess_tdof_list, increment, rhs);
+
+  ApplyMassInverse(rhs, increment);
+  for (int i = 0; i < _ess_tdof_list.Size(); ++i)
+  {
+    const int dof = _ess_tdof_list[i];
+    increment(dof) = bc_values(dof) - e(dof);
+  }
+  e += increment;
+
+  // Second half step of B.
+  _curl->Mult(e, curl_e);
+  b.Add(-0.5 * dt, curl_e);
+
+  _e_field->Distribute(e);
+  _b_field->Distribute(b);
+  increment /= dt;
+  _de_dt->Distribute(increment);
+  curl_e.Neg();
+  _db_dt->Distribute(curl_e);
+
+  t += dt;
+  _dual_operator->SetTime(t);
+
+  logger.info("{} Step: {} seconds", typeid(this).name(), sw);
+}
+
+} // namespace hephaestus
@@ -0,0 +1,99 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "dual_formulation.hpp"
+#include "inputs.hpp"
+
+namespace hephaestus
+{
+
+/// Explicit leapfrog time integrator for the wave form of the dual E-B system
+///
+/// ε dE/dt + σE = ∇×(νB) - J,  dB/dt = -∇×E,
+///
+/// with E ∈ H(curl) and B ∈ H(div), as set up by DualFormulation with linear materials. Each step
+/// of size h is a Störmer-Verlet step, with the conduction term treated by the trapezoidal rule:
+///
+/// B' = Bⁿ - h/2 C Eⁿ
+/// (M_ε + h/2 M_σ)(Eⁿ⁺¹ - Eⁿ) = h (Wᵀ B' - M_σ Eⁿ + J(tⁿ + h/2))
+/// Bⁿ⁺¹ = B' - h/2 C Eⁿ⁺¹
+///
+/// where C is the discrete curl of the DualOperator and W the weak curl form (νB, ∇×E'). The only
+/// inverse is that of the H(curl) mass matrix, which is applied with a fixed number
+/// ("ChebyshevIterations") of Jacobi-preconditioned Chebyshev iterations. Steps are therefore
+/// matrix-vector products with neighbour exchanges only, without global Krylov solves or
+/// reductions. Sources that solve for their own fields, such as DivFreeSource, are not covered by
+/// this.
+///
+/// The spectral bounds of the Chebyshev iteration are estimated by Lanczos iterations, and the
+/// largest stable time step by power iterations, whenever the time step changes. Steps beyond
+/// the estimated stability limit are reported. The permittivity coefficient is named by the
+/// "PermittivityCoefName" solver option. Boundaries without essential BCs on E are natural, with
+/// zero tangential νB unless integrated BCs are set.
+class DualLeapfrogSolver : public mfem::ODESolver
+{
+public:
+  DualLeapfrogSolver(const hephaestus::InputParameters & params, hephaestus::Problem & problem);
+
+  ~DualLeapfrogSolver() override = default;
+
+  void Init(mfem::TimeDependentOperator & f) override;
+
+  void Step(mfem::Vector & x, double & t, double & dt) override;
+
+private:
+  // Assembles the curl, weak curl and mass matrices for a time step of dt, and estimates the
+  // spectral bounds of the mass matrix and the stable time step.
+  void BuildOperators(double dt);
+
+  // Writes the loads from the sources and integrated BCs at time t to load, in true DOFs.
+  void AssembleLoad(double t, mfem::Vector & load);
+
+  // Writes the essential BC values of E at time t to values, in true DOFs.
+  void AssembleBoundaryValues(double t, mfem::Vector & values);
+
+  // Approximately solves (M_ε + h/2 M_σ) x = rhs by Chebyshev iteration.
+  void ApplyMassInverse(const mfem::Vector & rhs, mfem::Vector & x) const;
+
+  // Estimates the extreme eigenvalues of the Jacobi-preconditioned step mass matrix.
+  void EstimateMassBounds();
+
+  // Returns an estimate of the largest stable time step.
+  double EstimateStableTimeStep() const;
+
+  hephaestus::Problem & _problem;
+  hephaestus::DualOperator * _dual_operator{nullptr};
+
+  std::string _permittivity_coef_name;
+  int _chebyshev_iterations;
+
+  mfem::Coefficient * _permittivity{nullptr};
+  mfem::Coefficient * _conductivity{nullptr};
+  mfem::Coefficient * _reluctivity{nullptr};
+
+  mfem::ParGridFunction * _e_field{nullptr};
+  mfem::ParGridFunction * _b_field{nullptr};
+  mfem::ParGridFunction * _de_dt{nullptr};
+  mfem::ParGridFunction * _db_dt{nullptr};
+
+  double _dt{0.0};
+  std::unique_ptr<mfem::HypreParMatrix> _curl{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _weak_curl{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _conductivity_mass{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _step_mass{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _step_mass_eliminated{nullptr};
+
+  mfem::Array<int> _ess_tdof_list;
+  std::unique_ptr<mfem::ParGridFunction> _bc_values{nullptr};
+
+  // Linear form of the loads, with the integrated BCs of the BC map revision it was built for.
+  std::unique_ptr<mfem::ParLinearForm> _load_lf{nullptr};
+  std::size_t _load_lf_bc_revision{0};
+
+  // Inverse diagonal of the step mass matrix, and bounds on the spectrum of its Jacobi
+  // preconditioned form.
+  mfem::Vector _inverse_diagonal;
+  double _lambda_min{1.0};
+  double _lambda_max{1.0};
+};
+
+} // namespace hephaestus
@@ -0,0 +1,340 @@
+#include "hcurl_preconditioners.hpp"
+
+namespace hephaestus
+{
+
+HCurlPMultigridSolver::HCurlPMultigridSolver(const hephaestus::InputParameters & params,
+                                             mfem::ParFiniteElementSpace * edge_fespace)
+  : mfem::Solver(edge_fespace->GetTrueVSize()),
+    _edge_fespace(edge_fespace),
+    _smoother_order(params.GetOptionalParam<int>("SmootherOrder", 2)),
+    _smoother_fraction(params.GetOptionalNumericParam<double>("SmootherFraction", 0.3)),
+    _coarse_cycles(params.GetOptionalParam<int>("CoarseCycles", 2))
+{
+  if (_coarse_cycles < 1)
+  {
+    MFEM_ABORT("CoarseCycles must be at least 1.");
+  }
+
+  BuildHierarchy();
+}
+
+void
+HCurlPMultigridSolver::BuildHierarchy()
+{
+  mfem::ParMesh * pmesh = _edge_fespace->GetParMesh();
+  const int dim = pmesh->Dimension();
+  const int fine_order = _edge_fespace->FEColl()->GetOrder();
+
+  // Build the lower order spaces. The fine space is borrowed from the problem.
+  for (int order = 1; order < fine_order; ++order)
+  {
+    _fecs.push_back(std::make_unique<mfem::ND_FECollection>(order, dim));
+    _owned_fespaces.push_back(
+        std::make_unique<mfem::ParFiniteElementSpace>(pmesh, _fecs.back().get()));
+    _level_fespaces.push_back(_owned_fespaces.back().get());
+  }
+  _level_fespaces.push_back(_edge_fespace);
+
+  // Nédélec spaces are nested under p-refinement so the prolongation is the identity
+  // interpolation from the coarse to the fine space.
+  for (size_t level = 0; level + 1 < _level_fespaces.size(); ++level)
+  {
+    mfem::ParDiscreteLinearOperator interp(_level_fespaces[level], _level_fespaces[level + 1]);
+    interp.AddDomainInterpolator(new mfem::IdentityInterpolator);
+    interp.Assemble();
+    interp.Finalize();
+    _prolongations.emplace_back(interp.ParallelAssemble());
+  }
+
+  logger.info("Built H(curl) p-multigrid hierarchy with {} levels", _level_fespaces.size());
+}
+
+void
+HCurlPMultigridSolver::SetOperator(const mfem::Operator & op)
+{
+  spdlog::stopwatch sw;
+
+  const auto * fine_op = dynamic_cast<const mfem::HypreParMatrix *>(&op);
+  if (fine_op == nullptr)
+  {
+    MFEM_ABORT("HCurlPMultigridSolver requires a HypreParMatrix operator.");
+  }
+
+  height = width = fine_op->Height();
+
+  const size_t num_levels = _level_fespaces.size();
+
+  _owned_operators.clear();
+  _level_operators.assign(num_levels, nullptr);
+  _level_operators.back() = fine_op;
+
+  // Galerkin coarse operators. Essential DOFs have already been eliminated from the fine
+  // operator, so the coarse operators remain symmetric positive (semi-)definite.
+  for (size_t level = num_levels - 1; level > 0; --level)
+  {
+    _owned_operators.emplace_back(
+        mfem::RAP(_level_operators[level], _prolongations[level - 1].get()));
+    _level_operators[level - 1] = _owned_operators.back().get();
+  }
+
+  _smoothers.clear();
+  _smoothers.resize(num_levels);
+  for (size_t level = 1; level < num_levels; ++level)
+  {
+    auto smoother = std::make_unique<mfem::HypreSmoother>();
+    smoother->SetType(mfem::HypreSmoother::Chebyshev);
+    smoother->SetPolyOptions(_smoother_order, _smoother_fraction);
+    smoother->SetOperator(*_level_operators[level]);
+    smoother->iterative_mode = true;
+    _smoothers[level] = std::move(smoother);
+  }
+
+  // Each application of AMS is a single V-cycle. Applied from the current iterate, a fixed number
+  // of them is a stationary iteration, so the coarse solve is a fixed linear operator and the
+  // preconditioner remains usable with PCG.
+  _coarse_ams = std::make_unique<mfem::HypreAMS>(*_level_operators[0], _level_fespaces[0]);
+  _coarse_ams->SetSingularProblem();
+  _coarse_ams->SetPrintLevel(-1);
+  _coarse_ams->iterative_mode = true;
+
+  _residuals.resize(num_levels);
+  _corrections.resize(num_levels);
+  _coarse_rhs.resize(num_levels);
+  _coarse_sol.resize(num_levels);
+  for (size_t level = 1; level < num_levels; ++level)
+  {
+    _residuals[level].SetSize(_level_operators[level]->Height());
+    _corrections[level].SetSize(_level_operators[level]->Height());
+    _coarse_rhs[level].SetSize(_level_operators[level - 1]->Height());
+    _coarse_sol[level].SetSize(_level_operators[level - 1]->Height());
+  }
+
+  logger.info("{} SetOperator: {} seconds", typeid(this).name(), sw);
+}
+
+void
+HCurlPMultigridSolver::Mult(const mfem::Vector & x, mfem::Vector & y) const
+{
+  if (_coarse_ams == nullptr)
+  {
+    MFEM_ABORT("HCurlPMultigridSolver::SetOperator must be called before Mult.");
+  }
+
+  y = 0.0;
+  Cycle(static_cast<int>(_level_operators.size()) - 1, x, y);
+}
+
+void
+HCurlPMultigridSolver::Cycle(int level, const mfem::Vector & b, mfem::Vector & x) const
+{
+  if (level == 0)
+  {
+    x = 0.0;
+    for (int cycle = 0; cycle < _coarse_cycles; ++cycle)
+    {
+      _coarse_ams->Mult(b, x);
+    }
+    return;
+  }
+
+  const mfem::HypreParMatrix & op = *_level_operators[level];
+  mfem::Vector & r = _residuals[level];
+  mfem::Vector & rc = _coarse_rhs[level];
+  mfem::Vector & ec = _coarse_sol[level];
+  mfem::Vector & e = _corrections[level];
+
+  // Pre-smoothing.
+  x = 0.0;
+  _smoothers[level]->Mult(b, x);
+
+  // Restrict the residual and correct from the next level down.
+  op.Mult(x, r);
+  mfem::subtract(b, r, r);
+  _prolongations[level - 1]->MultTranspose(r, rc);
+
+  ec = 0.0;
+  Cycle(level - 1, rc, ec);
+
+  _prolongations[level - 1]->Mult(ec, e);
+  x += e;
+
+  // Post-smoothing.
+  _smoothers[level]->Mult(b, x);
+}
+
+namespace
+{
+
+/// Returns the wrapped coefficient where it is at least @a threshold and zero elsewhere.
+class ConductorCoefficient : public mfem::Coefficient
+{
+public:
+  ConductorCoefficient(mfem::Coefficient & coef, double threshold)
+    : _coef(coef), _threshold(threshold)
+  {
+  }
+
+  double Eval(mfem::ElementTransformation & T, const mfem::IntegrationPoint & ip) override
+  {
+    const double value = _coef.Eval(T, ip);
+    return (value >= _threshold) ? value : 0.0;
+  }
+
+  void SetTime(double t) override
+  {
+    mfem::Coefficient::SetTime(t);
+    _coef.SetTime(t);
+  }
+
+private:
+  mfem::Coefficient & _coef;
+  double _threshold;
+};
+
+} // namespace
+
+HypreMaterialAMS::HypreMaterialAMS(const hephaestus::InputParameters & params,
+                                   mfem::ParFiniteElementSpace * edge_fespace,
+                                   hephaestus::HCurlMaterialCoefficients materials)
+  : mfem::HypreAMS(edge_fespace),
+    _materials(std::move(materials)),
+    _cycle_type(params.GetOptionalParam<int>("AMSCycleType", _materials._beta ? 1 : 13)),
+    _relax_type(params.GetOptionalParam<int>("AMSRelaxType", 2)),
+    _relax_sweeps(params.GetOptionalParam<int>("AMSRelaxSweeps", _materials._beta ? 2 : 1)),
+    _strength_threshold(params.GetOptionalNumericParam<double>("AMSStrengthThreshold", 0.25)),
+    _conductor_threshold(params.GetOptionalNumericParam<double>("ConductorThreshold", 0.0))
+{
+  if (_materials._alpha == nullptr)
+  {
+    MFEM_ABORT("HypreMaterialAMS requires the curl-curl coefficient α.");
+  }
+
+  // Auxiliary nodal space matching the one used by AMS for the discrete gradient.
+  mfem::ParMesh * pmesh = edge_fespace->GetParMesh();
+  _h1_fec = std::make_unique<mfem::H1_FECollection>(edge_fespace->FEColl()->GetOrder(),
+                                                    pmesh->Dimension());
+  _h1_fespace = std::make_unique<mfem::ParFiniteElementSpace>(pmesh, _h1_fec.get());
+
+  if (_materials._ess_bdr.Size())
+  {
+    _h1_fespace->GetEssentialTrueDofs(_materials._ess_bdr, _h1_ess_tdofs);
+  }
+
+  if (_materials._beta && _conductor_threshold > 0.0)
+  {
+    _conductor_beta =
+        std::make_unique<ConductorCoefficient>(*_materials._beta, _conductor_threshold);
+  }
+
+  SetPrintLevel(-1);
+  ApplyOptions();
+}
+
+void
+HypreMaterialAMS::SetOperator(const mfem::Operator & op)
+{
+  spdlog::stopwatch sw;
+
+  mfem::HypreAMS::SetOperator(op);
+
+  _alpha_poisson = AssemblePoissonMatrix(*_materials._alpha);
+
+  if (_materials._beta)
+  {
+    _beta_poisson = AssemblePoissonMatrix(_conductor_beta ? *_conductor_beta : *_materials._beta);
+  }
+
+  ApplyOptions();
+
+  logger.info("{} SetOperator: {} seconds", typeid(this).name(), sw);
+}
+
+void
+HypreMaterialAMS::ApplyOptions()
+{
+  HYPRE_Solver ams = *this;
+
+  HYPRE_AMSSetCycleType(ams, _cycle_type);
+  HYPRE_AMSSetSmoothingOptions(ams, _relax_type, _relax_sweeps, 1.0, 1.0);
+  HYPRE_AMSSetAlphaAMGOptions(ams, 10, 1, 8, _strength_threshold, 6, 4);
+  HYPRE_AMSSetBetaAMGOptions(ams, 10, 1, 8, _strength_threshold, 6, 4);
+
+  if (_alpha_poisson)
+  {
+    HYPRE_AMSSetAlphaPoissonMatrix(ams, *_alpha_poisson);
+  }
+
+  if (_beta_poisson)
+  {
+    HYPRE_AMSSetBetaPoissonMatrix(ams, *_beta_poisson);
+  }
+  else if (_materials._beta == nullptr)
+  {
+    SetSingularProblem();
+  }
+}
+
+std::unique_ptr<mfem::HypreParMatrix>
+HypreMaterialAMS::AssemblePoissonMatrix(mfem::Coefficient & coef) const
+{
+  mfem::ParBilinearForm blf(_h1_fespace.get());
+  blf.AddDomainIntegrator(new mfem::DiffusionIntegrator(coef));
+  blf.Assemble();
+  blf.Finalize();
+
+  auto poisson = std::unique_ptr<mfem::HypreParMatrix>(blf.ParallelAssemble());
+
+  // Discard the eliminated part; only the constrained matrix is needed by AMS.
+  std::unique_ptr<mfem::HypreParMatrix> eliminated(poisson->EliminateRowsCols(_h1_ess_tdofs));
+
+  return poisson;
+}
+
+std::shared_ptr<mfem::Solver>
+CreateHCurlPreconditioner(const hephaestus::InputParameters & solver_options,
+                          mfem::ParFiniteElementSpace * edge_fespace,
+                          const hephaestus::HCurlMaterialCoefficients & materials,
+                          const std::string & default_type)
+{
+  auto type = solver_options.GetOptionalParam<std::string>("Preconditioner", default_type);
+
+  // Systems condensed onto the trace space are preconditioned by AMS on that space, whose nodal
+  // auxiliary space is built on the matching H1 trace space.
+  if (dynamic_cast<const mfem::ND_Trace_FECollection *>(edge_fespace->FEColl()) != nullptr &&
+      type != "AMS")
+  {
+    logger.info("{} preconditioner is not available on the trace space of a condensed system. "
+                "Using AMS.",
+                type);
+    type = "AMS";
+  }
+
+  if (type == "AMS")
+  {
+    auto precond = std::make_shared<mfem::HypreAMS>(edge_fespace);
+
+    precond->SetSingularProblem();
+    precond->SetPrintLevel(-1);
+
+    return precond;
+  }
+  else if (type == "MaterialAMS")
+  {
+    if (materials._alpha == nullptr)
+    {
+      MFEM_ABORT("MaterialAMS preconditioner requested without material coefficients.");
+    }
+
+    return std::make_shared<hephaestus::HypreMaterialAMS>(solver_options, edge_fespace, materials);
+  }
+  else if (type == "PMultigrid")
+  {
+    return std::make_shared<hephaestus::HCurlPMultigridSolver>(solver_options, edge_fespace);
+  }
+
+  MFEM_ABORT("Unrecognised H(curl) preconditioner '" << type << "'.");
+  return nullptr;
+}
+
+} // namespace hephaestus
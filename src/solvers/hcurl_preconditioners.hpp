@@ -0,0 +1,125 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "inputs.hpp"
+
+namespace hephaestus
+{
+
+/// Geometric p-multigrid preconditioner for high-order H(curl) systems.
+///
+/// The hierarchy is built on the same mesh from Nédélec spaces of order p, p-1, ..., 1. Coarse
+/// operators are formed algebraically (Galerkin RAP) from the fine operator passed in
+/// @a SetOperator, so no bilinear form is needed. Chebyshev-Jacobi smoothing is applied on the
+/// high-order levels and the order 1 level is solved approximately with a fixed number
+/// ("CoarseCycles") of AMS V-cycles. A single application performs one symmetric V-cycle, and is a
+/// fixed linear operator, so the preconditioner may be used within PCG.
+class HCurlPMultigridSolver : public mfem::Solver
+{
+public:
+  HCurlPMultigridSolver(const hephaestus::InputParameters & params,
+                        mfem::ParFiniteElementSpace * edge_fespace);
+
+  ~HCurlPMultigridSolver() override = default;
+
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & x, mfem::Vector & y) const override;
+
+  /// Returns the number of levels in the hierarchy (including the order 1 coarse level).
+  [[nodiscard]] int NumLevels() const { return static_cast<int>(_level_fespaces.size()); }
+
+private:
+  void BuildHierarchy();
+  void Cycle(int level, const mfem::Vector & b, mfem::Vector & x) const;
+
+  mfem::ParFiniteElementSpace * _edge_fespace{nullptr};
+
+  int _smoother_order;
+  double _smoother_fraction;
+  int _coarse_cycles;
+
+  // Level 0 is the order 1 space; the last level is the user's edge space.
+  std::vector<std::unique_ptr<mfem::FiniteElementCollection>> _fecs;
+  std::vector<std::unique_ptr<mfem::ParFiniteElementSpace>> _owned_fespaces;
+  std::vector<mfem::ParFiniteElementSpace *> _level_fespaces;
+
+  // _prolongations[l] maps true dofs on level l to true dofs on level l + 1.
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> _prolongations;
+
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> _owned_operators;
+  std::vector<const mfem::HypreParMatrix *> _level_operators;
+  std::vector<std::unique_ptr<mfem::HypreSmoother>> _smoothers;
+
+  std::unique_ptr<mfem::HypreAMS> _coarse_ams{nullptr};
+
+  mutable std::vector<mfem::Vector> _residuals;
+  mutable std::vector<mfem::Vector> _coarse_rhs;
+  mutable std::vector<mfem::Vector> _coarse_sol;
+  mutable std::vector<mfem::Vector> _corrections;
+};
+
+/// Material coefficients of an H(curl) system (α∇×u, ∇×u') + (βu, u'). A null β denotes a
+/// singular curl-curl problem. Essential boundary markers are used to eliminate the matching
+/// nodal DOFs from the auxiliary Poisson matrices.
+struct HCurlMaterialCoefficients
+{
+  mfem::Coefficient * _alpha{nullptr};
+  mfem::Coefficient * _beta{nullptr};
+  mfem::Array<int> _ess_bdr;
+};
+
+/// AMS preconditioner whose auxiliary nodal Poisson matrices are assembled from the material
+/// coefficients, (α∇φ, ∇φ') and (β∇φ, ∇φ'), rather than formed as Galerkin products. This keeps
+/// AMS robust for large conductivity contrasts. β may be restricted to conductors by zeroing it
+/// wherever it falls below the "ConductorThreshold" solver option.
+///
+/// Cycle type and smoother defaults depend on the problem class: transient/eddy-current
+/// problems (β supplied) use the multiplicative "01210" cycle, while singular magnetostatic
+/// problems keep the additive-multiplicative cycle 13. Both may be overridden with
+/// "AMSCycleType", "AMSRelaxType", "AMSRelaxSweeps" and "AMSStrengthThreshold".
+class HypreMaterialAMS : public mfem::HypreAMS
+{
+public:
+  HypreMaterialAMS(const hephaestus::InputParameters & params,
+                   mfem::ParFiniteElementSpace * edge_fespace,
+                   hephaestus::HCurlMaterialCoefficients materials);
+
+  ~HypreMaterialAMS() override = default;
+
+  /// Reassembles the Poisson matrices, since coefficients such as dt*α change with the timestep.
+  void SetOperator(const mfem::Operator & op) override;
+
+private:
+  void ApplyOptions();
+
+  [[nodiscard]] std::unique_ptr<mfem::HypreParMatrix>
+  AssemblePoissonMatrix(mfem::Coefficient & coef) const;
+
+  hephaestus::HCurlMaterialCoefficients _materials;
+
+  int _cycle_type;
+  int _relax_type;
+  int _relax_sweeps;
+  double _strength_threshold;
+  double _conductor_threshold;
+
+  std::unique_ptr<mfem::H1_FECollection> _h1_fec{nullptr};
+  std::unique_ptr<mfem::ParFiniteElementSpace> _h1_fespace{nullptr};
+  mfem::Array<int> _h1_ess_tdofs;
+
+  std::unique_ptr<mfem::Coefficient> _conductor_beta{nullptr};
+
+  std::unique_ptr<mfem::HypreParMatrix> _alpha_poisson{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _beta_poisson{nullptr};
+};
+
+/// Creates the Jacobian preconditioner for an H(curl) system from the "Preconditioner" solver
+/// option. Supported values are "AMS", "MaterialAMS" and "PMultigrid"; @a default_type is used if
+/// the option is absent. "MaterialAMS" requires the material coefficients to be supplied.
+std::shared_ptr<mfem::Solver>
+CreateHCurlPreconditioner(const hephaestus::InputParameters & solver_options,
+                          mfem::ParFiniteElementSpace * edge_fespace,
+                          const hephaestus::HCurlMaterialCoefficients & materials = {},
+                          const std::string & default_type = "AMS");
+
+} // namespace hephaestus
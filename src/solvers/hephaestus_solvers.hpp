@@ -1,6 +1,13 @@
 #pragma once
 #include "../common/pfem_extras.hpp"
+#include "autotune_solver.hpp"
+#include "hcurl_preconditioners.hpp"
 #include "inputs.hpp"
+#include "iterative_refinement_solver.hpp"
+#include "linear_solver_params.hpp"
+#include "linear_tolerance_policy.hpp"
+#include "nested_iteration.hpp"
+#include "pipelined_krylov_solvers.hpp"
 
 namespace hephaestus
 {
@@ -9,12 +16,17 @@ class DefaultH1PCGSolver : public mfem::HyprePCG
 {
 public:
   DefaultH1PCGSolver(const hephaestus::InputParameters & params, const mfem::HypreParMatrix & M)
+    : DefaultH1PCGSolver(hephaestus::LinearSolverParams::Parse(params, {._tolerance = 1.0e-9}), M)
+  {
+  }
+
+  DefaultH1PCGSolver(const hephaestus::LinearSolverParams & params, const mfem::HypreParMatrix & M)
     : mfem::HyprePCG(M),
       _amg(M),
-      _tol(params.GetOptionalParam<float>("Tolerance", 1.0e-9)),
-      _abstol(params.GetOptionalParam<float>("AbsTolerance", 1e-16)),
-      _max_iter(params.GetOptionalParam<unsigned int>("MaxIter", 1000)),
-      _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
   {
 
     _amg.SetPrintLevel(_print_level);
@@ -35,12 +47,19 @@ class DefaultJacobiPCGSolver : public mfem::HyprePCG
 {
 public:
   DefaultJacobiPCGSolver(const hephaestus::InputParameters & params, const mfem::HypreParMatrix & M)
+    : DefaultJacobiPCGSolver(
+          hephaestus::LinearSolverParams::Parse(params, {._tolerance = 1.0e-9}), M)
+  {
+  }
+
+  DefaultJacobiPCGSolver(const hephaestus::LinearSolverParams & params,
+                         const mfem::HypreParMatrix & M)
     : mfem::HyprePCG(M),
       _jacobi(M),
-      _tol(params.GetOptionalParam<float>("Tolerance", 1.0e-9)),
-      _abstol(params.GetOptionalParam<float>("AbsTolerance", 1e-16)),
-      _max_iter(params.GetOptionalParam<unsigned int>("MaxIter", 1000)),
-      _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
   {
 
     SetTol(_tol);
@@ -62,12 +81,19 @@ public:
   DefaultHCurlPCGSolver(const hephaestus::InputParameters & params,
                         const mfem::HypreParMatrix & M,
                         mfem::ParFiniteElementSpace * edge_fespace)
+    : DefaultHCurlPCGSolver(hephaestus::LinearSolverParams::Parse(params), M, edge_fespace)
+  {
+  }
+
+  DefaultHCurlPCGSolver(const hephaestus::LinearSolverParams & params,
+                        const mfem::HypreParMatrix & M,
+                        mfem::ParFiniteElementSpace * edge_fespace)
     : mfem::HyprePCG(M),
       _ams(M, edge_fespace),
-      _tol(params.GetOptionalParam<float>("Tolerance", 1.0e-16)),
-      _abstol(params.GetOptionalParam<float>("AbsTolerance", 1e-16)),
-      _max_iter(params.GetOptionalParam<unsigned int>("MaxIter", 1000)),
-      _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
   {
 
     _ams.SetSingularProblem();
@@ -91,12 +117,20 @@ public:
   DefaultHCurlFGMRESSolver(const hephaestus::InputParameters & params,
                            const mfem::HypreParMatrix & M,
                            mfem::ParFiniteElementSpace * edge_fespace)
+    : DefaultHCurlFGMRESSolver(
+          hephaestus::LinearSolverParams::Parse(params, {._max_iteration = 100}), M, edge_fespace)
+  {
+  }
+
+  DefaultHCurlFGMRESSolver(const hephaestus::LinearSolverParams & params,
+                           const mfem::HypreParMatrix & M,
+                           mfem::ParFiniteElementSpace * edge_fespace)
     : mfem::HypreFGMRES(M),
       _ams(M, edge_fespace),
-      _tol(params.GetOptionalParam<float>("Tolerance", 1e-16)),
-      _max_iter(params.GetOptionalParam<unsigned int>("MaxIter", 100)),
-      _k_dim(params.GetOptionalParam<unsigned int>("KDim", 10)),
-      _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+      _tol(params._tolerance),
+      _max_iter(params._max_iteration),
+      _k_dim(params._k_dim),
+      _print_level(params._print_level)
   {
 
     _ams.SetSingularProblem();
@@ -118,12 +152,17 @@ class DefaultGMRESSolver : public mfem::HypreGMRES
 {
 public:
   DefaultGMRESSolver(const hephaestus::InputParameters & params, const mfem::HypreParMatrix & M)
+    : DefaultGMRESSolver(hephaestus::LinearSolverParams::Parse(params), M)
+  {
+  }
+
+  DefaultGMRESSolver(const hephaestus::LinearSolverParams & params, const mfem::HypreParMatrix & M)
     : mfem::HypreGMRES(M),
       _amg(M),
-      _tol(params.GetOptionalParam<float>("Tolerance", 1e-16)),
-      _abstol(params.GetOptionalParam<float>("AbsTolerance", 1e-16)),
-      _max_iter(params.GetOptionalParam<unsigned int>("MaxIter", 1000)),
-      _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
   {
 
     _amg.SetPrintLevel(_print_level);
@@ -140,6 +179,80 @@ public:
   int _print_level;
 };
 
+/// Pipelined variant of @a DefaultH1PCGSolver for latency-bound solves at large rank counts.
+class DefaultH1PipelinedCGSolver : public hephaestus::PipelinedCGSolver
+{
+public:
+  DefaultH1PipelinedCGSolver(const hephaestus::InputParameters & params,
+                             const mfem::HypreParMatrix & M)
+    : DefaultH1PipelinedCGSolver(
+          hephaestus::LinearSolverParams::Parse(params, {._tolerance = 1.0e-9}), M)
+  {
+  }
+
+  DefaultH1PipelinedCGSolver(const hephaestus::LinearSolverParams & params,
+                             const mfem::HypreParMatrix & M)
+    : hephaestus::PipelinedCGSolver(M.GetComm()),
+      _amg(M),
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
+  {
+
+    _amg.SetPrintLevel(_print_level);
+    SetRelTol(_tol);
+    SetAbsTol(_abstol);
+    SetMaxIter(_max_iter);
+    SetPrintLevel(_print_level);
+    SetPreconditioner(_amg);
+    SetOperator(M);
+  }
+  mfem::HypreBoomerAMG _amg;
+  double _tol;
+  double _abstol;
+  int _max_iter;
+  int _print_level;
+};
+
+/// Pipelined variant of @a DefaultHCurlPCGSolver for latency-bound solves at large rank counts.
+class DefaultHCurlPipelinedCGSolver : public hephaestus::PipelinedCGSolver
+{
+public:
+  DefaultHCurlPipelinedCGSolver(const hephaestus::InputParameters & params,
+                                const mfem::HypreParMatrix & M,
+                                mfem::ParFiniteElementSpace * edge_fespace)
+    : DefaultHCurlPipelinedCGSolver(hephaestus::LinearSolverParams::Parse(params), M, edge_fespace)
+  {
+  }
+
+  DefaultHCurlPipelinedCGSolver(const hephaestus::LinearSolverParams & params,
+                                const mfem::HypreParMatrix & M,
+                                mfem::ParFiniteElementSpace * edge_fespace)
+    : hephaestus::PipelinedCGSolver(M.GetComm()),
+      _ams(M, edge_fespace),
+      _tol(params._tolerance),
+      _abstol(params._abs_tolerance),
+      _max_iter(params._max_iteration),
+      _print_level(params._print_level)
+  {
+
+    _ams.SetSingularProblem();
+    _ams.SetPrintLevel(_print_level);
+    SetRelTol(_tol);
+    SetAbsTol(_abstol);
+    SetMaxIter(_max_iter);
+    SetPrintLevel(_print_level);
+    SetPreconditioner(_ams);
+    SetOperator(M);
+  }
+  mfem::HypreAMS _ams;
+  double _tol;
+  double _abstol;
+  int _max_iter;
+  int _print_level;
+};
+
 class SuperLUSolver : public mfem::SuperLUSolver
 {
 public:
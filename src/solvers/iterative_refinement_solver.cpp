@@ -0,0 +1,89 @@
+#include "iterative_refinement_solver.hpp"
+
+namespace hephaestus
+{
+
+IterativeRefinementSolver::IterativeRefinementSolver(MPI_Comm comm,
+                                                     std::shared_ptr<mfem::Solver> inner_solver)
+  : mfem::IterativeSolver(comm), _inner_solver(std::move(inner_solver))
+{
+  if (!_inner_solver)
+  {
+    MFEM_ABORT("IterativeRefinementSolver requires an inner solver.");
+  }
+}
+
+void
+IterativeRefinementSolver::SetOperator(const mfem::Operator & op)
+{
+  mfem::IterativeSolver::SetOperator(op);
+  _inner_solver->SetOperator(op);
+}
+
+void
+IterativeRefinementSolver::Mult(const mfem::Vector & b, mfem::Vector & x) const
+{
+  _r.SetSize(b.Size());
+  _d.SetSize(b.Size());
+
+  if (iterative_mode)
+  {
+    oper->Mult(x, _r);
+    mfem::subtract(b, _r, _r);
+  }
+  else
+  {
+    x = 0.0;
+    _r = b;
+  }
+
+  double norm = Norm(_r);
+  const double target = std::max(rel_tol * norm, abs_tol);
+
+  auto * inner_iterative = dynamic_cast<mfem::IterativeSolver *>(_inner_solver.get());
+  _inner_iterations = 0;
+
+  converged = (norm <= target);
+  final_iter = 0;
+
+  while (!converged && final_iter < max_iter)
+  {
+    // Correction from the reduced-accuracy inner solve.
+    _inner_solver->iterative_mode = false;
+    _inner_solver->Mult(_r, _d);
+    x += _d;
+
+    if (inner_iterative)
+    {
+      _inner_iterations += inner_iterative->GetNumIterations();
+    }
+
+    // True residual in full precision.
+    oper->Mult(x, _r);
+    mfem::subtract(b, _r, _r);
+    norm = Norm(_r);
+
+    ++final_iter;
+    converged = (norm <= target);
+
+    if (print_options.iterations)
+    {
+      mfem::out << "   Refinement : " << std::setw(3) << final_iter << "  ||r|| = " << norm
+                << '\n';
+    }
+  }
+
+  final_norm = norm;
+
+  if (print_options.summary || (print_options.warnings && !converged))
+  {
+    mfem::out << "IterativeRefinement: Number of refinement steps: " << final_iter
+              << ", inner iterations: " << _inner_iterations << '\n';
+  }
+  if (print_options.warnings && !converged)
+  {
+    mfem::out << "IterativeRefinement: No convergence!\n";
+  }
+}
+
+} // namespace hephaestus
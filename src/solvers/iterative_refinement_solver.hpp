@@ -0,0 +1,40 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+
+namespace hephaestus
+{
+
+/// Double-precision iterative refinement around a reduced-accuracy inner solver.
+///
+/// Each outer iteration computes the true residual r = b - Ax in double precision, solves
+/// A d = r approximately with the inner solver and updates x += d. The inner solver only needs to
+/// reduce the residual by a modest factor, so it may run at a loose tolerance (or in reduced
+/// precision) while the outer loop recovers full accuracy.
+///
+/// Hephaestus is built in double precision throughout, so there is no precision to recover: each
+/// outer step then costs an extra inner solve and residual, and the loop only acts as a restarted
+/// Krylov method whose convergence is checked on the true residual. It is therefore only used when
+/// the "IterativeRefinement" solver option is set, and is off by default.
+class IterativeRefinementSolver : public mfem::IterativeSolver
+{
+public:
+  IterativeRefinementSolver(MPI_Comm comm, std::shared_ptr<mfem::Solver> inner_solver);
+
+  ~IterativeRefinementSolver() override = default;
+
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & b, mfem::Vector & x) const override;
+
+  /// Returns the total number of inner iterations of the last solve, if the inner solver is an
+  /// mfem::IterativeSolver.
+  [[nodiscard]] int GetNumInnerIterations() const { return _inner_iterations; }
+
+private:
+  std::shared_ptr<mfem::Solver> _inner_solver{nullptr};
+
+  mutable mfem::Vector _r, _d;
+  mutable int _inner_iterations{0};
+};
+
+} // namespace hephaestus
@@ -0,0 +1,309 @@
+#include "krylov_exponential_solver.hpp"
+#include "utils.hpp"
+
+namespace hephaestus
+{
+
+namespace
+{
+
+// Writes phi_0(z), ..., phi_n(z) to phi, where phi_0(z) = exp(z) and
+// phi_k(z) = ∫ exp((1 - s)z) s^(k-1) / (k-1)! ds over [0, 1].
+void
+PhiFunctions(double z, int n, std::vector<double> & phi)
+{
+  phi.resize(n + 1);
+  if (fabs(z) < 1.0)
+  {
+    // Taylor series phi_k(z) = sum z^i / (i + k)!, which avoids the cancellation of the recurrence.
+    double factorial = 1.0;
+    for (int k = 0; k <= n; ++k)
+    {
+      factorial *= (k > 0) ? k : 1;
+      double term = 1.0 / factorial;
+      phi[k] = term;
+      for (int i = 1; i < 30; ++i)
+      {
+        term *= z / (i + k);
+        phi[k] += term;
+      }
+    }
+  }
+  else
+  {
+    phi[0] = exp(z);
+    double factorial = 1.0;
+    for (int k = 1; k <= n; ++k)
+    {
+      phi[k] = (phi[k - 1] - 1.0 / factorial) / z;
+      factorial *= k;
+    }
+  }
+}
+
+} // namespace
+
+KrylovExponentialSolver::KrylovExponentialSolver(const hephaestus::InputParameters & params,
+                                                 mfem::Solver & jacobian_solver)
+  : _jacobian_solver(&jacobian_solver),
+    _krylov_dim(params.GetOptionalParam<int>("KrylovDimension", 20)),
+    _num_quadrature_points(params.GetOptionalParam<int>("SourceQuadraturePoints", 3)),
+    _shift_fraction(params.GetOptionalNumericParam<double>("KrylovShiftFraction", 0.1))
+{
+  if (_num_quadrature_points < 2)
+  {
+    MFEM_ABORT("KrylovExponentialSolver requires at least 2 source quadrature points.");
+  }
+}
+
+void
+KrylovExponentialSolver::Init(mfem::TimeDependentOperator & f)
+{
+  mfem::ODESolver::Init(f);
+
+  _problem_operator = dynamic_cast<hephaestus::TimeDomainEquationSystemProblemOperator *>(&f);
+  if (_problem_operator == nullptr)
+  {
+    MFEM_ABORT("KrylovExponentialSolver requires a TimeDomainEquationSystemProblemOperator.");
+  }
+
+  _stiffness.reset();
+  _end_load_valid = false;
+}
+
+void
+KrylovExponentialSolver::BuildOperators(double shift)
+{
+  // The matrix for a time step of γ is assembled last, so that the equation system is left with
+  // the time step of the preconditioner.
+  mfem::Vector load;
+  _shifted = std::make_unique<mfem::HypreParMatrix>(
+      _problem_operator->AssembleMassAndStiffness(shift, _mass, _stiffness, load));
+
+  _jacobian_solver->SetOperator(*_shifted);
+  _shift = shift;
+  _end_load_valid = false;
+}
+
+void
+KrylovExponentialSolver::AssembleLoad(double t, const mfem::Vector & state, mfem::Vector & load)
+{
+  // The right-hand side of the implicit step is g - K u. Only its linear forms and sources depend
+  // on t, so the operator assembled in BuildOperators is kept.
+  _problem_operator->SetTime(t);
+  _problem_operator->AssembleImplicitRHS(load);
+  _stiffness->Mult(1.0, state, 1.0, load);
+}
+
+void
+KrylovExponentialSolver::SolveShifted(const mfem::Vector & rhs, mfem::Vector & x)
+{
+  x.SetSize(rhs.Size());
+  x = 0.0;
+  _jacobian_solver->Mult(rhs, x);
+}
+
+bool
+KrylovExponentialSolver::AddToBasis(mfem::Vector & candidate)
+{
+  const MPI_Comm comm = _mass->GetComm();
+  mfem::Vector mass_candidate(candidate.Size());
+
+  _mass->Mult(candidate, mass_candidate);
+  const double initial_norm = sqrt(mfem::InnerProduct(comm, candidate, mass_candidate));
+  if (initial_norm == 0.0)
+  {
+    return false;
+  }
+
+  // Modified Gram-Schmidt in the M inner product, repeated once for orthogonality to round-off.
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (size_t i = 0; i < _basis.size(); ++i)
+    {
+      candidate.Add(-mfem::InnerProduct(comm, _mass_basis[i], candidate), _basis[i]);
+    }
+  }
+
+  _mass->Mult(candidate, mass_candidate);
+  const double norm = sqrt(mfem::InnerProduct(comm, candidate, mass_candidate));
+  if (norm <= 1.0e-10 * initial_norm)
+  {
+    return false;
+  }
+
+  candidate /= norm;
+  mass_candidate /= norm;
+  _basis.push_back(candidate);
+  _mass_basis.push_back(mass_candidate);
+  return true;
+}
+
+void
+KrylovExponentialSolver::Step(mfem::Vector & x, double & t, double & dt)
+{
+  spdlog::stopwatch sw;
+
+  const double shift = _shift_fraction * dt;
+  if (!_stiffness || fabs(shift - _shift) > 1.0e-12 * shift)
+  {
+    _problem_operator->SetTime(t);
+    BuildOperators(shift);
+  }
+
+  mfem::Vector state;
+  _problem_operator->GetTrueState(state);
+
+  // Shifted loads (M + γK)⁻¹ g at the quadrature points.
+  mfem::IntegrationRule quadrature;
+  mfem::QuadratureFunctions1D::GaussLobatto(_num_quadrature_points, &quadrature);
+
+  std::vector<mfem::Vector> shifted_loads(_num_quadrature_points);
+  mfem::Vector load;
+  for (int q = 0; q < _num_quadrature_points; ++q)
+  {
+    if (q == 0 && _end_load_valid && fabs(_end_load_time - t) <= 1.0e-12 * dt)
+    {
+      shifted_loads[q] = _end_load;
+      continue;
+    }
+    AssembleLoad(t + quadrature.IntPoint(q).x * dt, state, load);
+    SolveShifted(load, shifted_loads[q]);
+  }
+
+  // Rational Krylov space of Z from the state and shifted loads. Z is self-adjoint in the M inner
+  // product, so the projection of Z onto an M-orthonormal basis is symmetric.
+  _basis.clear();
+  _mass_basis.clear();
+  _images.clear();
+
+  mfem::Vector candidate(state);
+  AddToBasis(candidate);
+  for (const auto & shifted_load : shifted_loads)
+  {
+    candidate = shifted_load;
+    AddToBasis(candidate);
+  }
+
+  for (size_t j = 0; j < _basis.size(); ++j)
+  {
+    _images.emplace_back();
+    SolveShifted(_mass_basis[j], _images.back());
+    if (static_cast<int>(_basis.size()) < _krylov_dim)
+    {
+      candidate = _images.back();
+      AddToBasis(candidate);
+    }
+  }
+
+  const int dim = static_cast<int>(_basis.size());
+  const int num_coords = _num_quadrature_points + 1;
+
+  // Projected Z, and coordinates of the state and shifted loads, with a single reduction.
+  mfem::DenseMatrix projected(dim, dim + num_coords);
+  for (int i = 0; i < dim; ++i)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      projected(i, j) = _mass_basis[i] * _images[j];
+    }
+    projected(i, dim) = _mass_basis[i] * state;
+    for (int q = 0; q < _num_quadrature_points; ++q)
+    {
+      projected(i, dim + 1 + q) = _mass_basis[i] * shifted_loads[q];
+    }
+  }
+  MPI_Allreduce(MPI_IN_PLACE,
+                projected.Data(),
+                projected.Height() * projected.Width(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                _mass->GetComm());
+
+  mfem::DenseMatrix projected_z(dim);
+  for (int i = 0; i < dim; ++i)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      projected_z(i, j) = 0.5 * (projected(i, j) + projected(j, i));
+    }
+  }
+
+  // Eigenvalues θ of the projected Z give those of A as λ = (1/θ - 1)/γ.
+  mfem::Vector theta;
+  mfem::DenseMatrix eigenvectors;
+  SymmetricEigensystem(projected_z, theta, eigenvectors);
+
+  // Coordinates of the state and shifted loads in the eigenvector basis.
+  mfem::DenseMatrix coords(dim, num_coords), eigen_coords(dim, num_coords);
+  coords.CopyMN(projected, dim, num_coords, 0, dim);
+  mfem::MultAtB(eigenvectors, coords, eigen_coords);
+
+  // Monomial coefficients of the Lagrange polynomials through the quadrature points.
+  mfem::DenseMatrix vandermonde(_num_quadrature_points);
+  for (int q = 0; q < _num_quadrature_points; ++q)
+  {
+    for (int k = 0; k < _num_quadrature_points; ++k)
+    {
+      vandermonde(q, k) = pow(quadrature.IntPoint(q).x, k);
+    }
+  }
+  mfem::DenseMatrixInverse lagrange(vandermonde);
+  mfem::DenseMatrix lagrange_coefficients(_num_quadrature_points);
+  lagrange.GetInverseMatrix(lagrange_coefficients);
+
+  mfem::Vector new_coords(dim), rate_coords(dim);
+  std::vector<double> phi;
+  for (int k = 0; k < dim; ++k)
+  {
+    const double theta_k = std::min(std::max(theta(k), 1.0e-14), 1.0);
+    const double lambda = (1.0 / theta_k - 1.0) / _shift;
+    PhiFunctions(-dt * lambda, _num_quadrature_points, phi);
+
+    // M⁻¹g = (I + γA) (M + γK)⁻¹ g, and (1 + γλ) = 1/θ.
+    double value = phi[0] * eigen_coords(k, 0);
+    for (int q = 0; q < _num_quadrature_points; ++q)
+    {
+      // ∫ exp(-(h - s)λ) l_q(s/h) ds for the Lagrange polynomial l_q of quadrature point q.
+      double weight = 0.0;
+      double factorial = 1.0;
+      for (int j = 0; j < _num_quadrature_points; ++j)
+      {
+        factorial *= (j > 0) ? j : 1;
+        weight += lagrange_coefficients(j, q) * factorial * phi[j + 1];
+      }
+      value += dt * weight * eigen_coords(k, q + 1) / theta_k;
+    }
+    new_coords(k) = value;
+
+    // du/dt = M⁻¹g - A u at the end of the step, which is the last Gauss-Lobatto point.
+    rate_coords(k) = eigen_coords(k, _num_quadrature_points) / theta_k - lambda * value;
+  }
+
+  mfem::Vector basis_coords(dim), new_state(state.Size()), rate(state.Size());
+  new_state = 0.0;
+  rate = 0.0;
+  eigenvectors.Mult(new_coords, basis_coords);
+  for (int i = 0; i < dim; ++i)
+  {
+    new_state.Add(basis_coords(i), _basis[i]);
+  }
+  eigenvectors.Mult(rate_coords, basis_coords);
+  for (int i = 0; i < dim; ++i)
+  {
+    rate.Add(basis_coords(i), _basis[i]);
+  }
+
+  _problem_operator->SetTrueState(new_state, rate);
+
+  t += dt;
+  _problem_operator->SetTime(t);
+
+  _end_load = shifted_loads.back();
+  _end_load_time = t;
+  _end_load_valid = true;
+
+  logger.info("{} Step: {} Krylov vectors, {} seconds", typeid(this).name(), dim, sw);
+}
+
+} // namespace hephaestus
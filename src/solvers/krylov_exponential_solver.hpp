@@ -0,0 +1,76 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "inputs.hpp"
+#include "time_domain_equation_system_problem_operator.hpp"
+
+namespace hephaestus
+{
+
+/// Exponential time integrator for linear problems
+///
+/// M du/dt + K u = g(t)
+///
+/// with constant M and K, such as the eddy current formulations with linear materials. Each step
+/// of size h evaluates
+///
+/// u(t + h) = exp(-hA) u(t) + ∫ exp(-(h - s)A) M⁻¹ g(t + s) ds,  A = M⁻¹K,
+///
+/// on a shift-and-invert Krylov subspace of Z = (M + γK)⁻¹ M, built from the state and the loads at
+/// the Gauss-Lobatto points of the step. Each application of Z is a solve with the Jacobian solver
+/// of the problem, set up with the implicit step matrix for a time step of
+/// γ = "KrylovShiftFraction" times h. The homogeneous part is stepped exactly in the subspace. The
+/// source integral is found by exponential quadrature: the load is interpolated in time through the
+/// quadrature points, and the interpolant integrated exactly against the exponential, so that stiff
+/// modes stay accurate. Steps are then limited by the time variation of the sources rather than by
+/// the accuracy of backward Euler.
+///
+/// M and K are recovered from the implicit step matrices for time steps of γ and 2γ. Essential BCs
+/// must have zero time derivative.
+class KrylovExponentialSolver : public mfem::ODESolver
+{
+public:
+  KrylovExponentialSolver(const hephaestus::InputParameters & params,
+                          mfem::Solver & jacobian_solver);
+
+  ~KrylovExponentialSolver() override = default;
+
+  void Init(mfem::TimeDependentOperator & f) override;
+
+  void Step(mfem::Vector & x, double & t, double & dt) override;
+
+private:
+  // Forms M, K and M + γK, and sets up the Jacobian solver with M + γK.
+  void BuildOperators(double shift);
+
+  // Writes the load g(t) in true DOFs to load.
+  void AssembleLoad(double t, const mfem::Vector & state, mfem::Vector & load);
+
+  // Solves (M + γK) x = rhs.
+  void SolveShifted(const mfem::Vector & rhs, mfem::Vector & x);
+
+  // M-orthonormalises candidate against the basis and appends it, unless it lies in the span of the
+  // basis. Returns whether it was appended.
+  bool AddToBasis(mfem::Vector & candidate);
+
+  hephaestus::TimeDomainEquationSystemProblemOperator * _problem_operator{nullptr};
+  mfem::Solver * _jacobian_solver{nullptr};
+
+  int _krylov_dim;
+  int _num_quadrature_points;
+  double _shift_fraction;
+
+  double _shift{0.0};
+  std::unique_ptr<mfem::HypreParMatrix> _shifted{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _mass{nullptr};
+  std::unique_ptr<mfem::HypreParMatrix> _stiffness{nullptr};
+
+  // Krylov basis, M times the basis, and Z times the basis.
+  std::vector<mfem::Vector> _basis, _mass_basis, _images;
+
+  // (M + γK)⁻¹ g at the end of the last step, reused at the start of the next.
+  mfem::Vector _end_load;
+  double _end_load_time{0.0};
+  bool _end_load_valid{false};
+};
+
+} // namespace hephaestus
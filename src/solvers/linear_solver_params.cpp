@@ -0,0 +1,25 @@
+#include "linear_solver_params.hpp"
+
+namespace hephaestus
+{
+
+LinearSolverParams
+LinearSolverParams::Parse(const hephaestus::InputParameters & params, LinearSolverParams defaults)
+{
+  static const auto schema = ParameterSchema<LinearSolverParams>()
+                                 .Optional("Tolerance", &LinearSolverParams::_tolerance)
+                                 .Optional("AbsTolerance", &LinearSolverParams::_abs_tolerance)
+                                 .Optional("MaxIter", &LinearSolverParams::_max_iteration)
+                                 .Optional("PrintLevel", &LinearSolverParams::_print_level)
+                                 .Optional("KDim", &LinearSolverParams::_k_dim);
+
+  return schema.Parse(params, defaults);
+}
+
+LinearSolverParams
+LinearSolverParams::Parse(const hephaestus::InputParameters & params)
+{
+  return Parse(params, LinearSolverParams());
+}
+
+} // namespace hephaestus
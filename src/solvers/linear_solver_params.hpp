@@ -0,0 +1,28 @@
+#pragma once
+#include "parameter_schema.hpp"
+
+namespace hephaestus
+{
+
+/// Settings shared by the Krylov solvers, read from the "Tolerance", "AbsTolerance", "MaxIter",
+/// "PrintLevel" and "KDim" solver options. The member initialisers are the defaults used by
+/// solvers that do not supply their own.
+struct LinearSolverParams
+{
+  double _tolerance{1.0e-12};
+  double _abs_tolerance{1.0e-16};
+
+  unsigned int _max_iteration{1000};
+
+  int _print_level{GetGlobalPrintLevel()};
+  int _k_dim{10};
+
+  /// Returns @a defaults overridden by any of the solver options set in @a params.
+  static LinearSolverParams Parse(const hephaestus::InputParameters & params,
+                                  LinearSolverParams defaults);
+
+  /// Returns the default settings overridden by any of the solver options set in @a params.
+  static LinearSolverParams Parse(const hephaestus::InputParameters & params);
+};
+
+} // namespace hephaestus
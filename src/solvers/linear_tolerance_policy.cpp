@@ -0,0 +1,88 @@
+#include "linear_tolerance_policy.hpp"
+#include "autotune_solver.hpp"
+
+#include <algorithm>
+
+namespace hephaestus
+{
+
+LinearTolerancePolicy::LinearTolerancePolicy(const hephaestus::InputParameters & solver_options,
+                                             MPI_Comm comm)
+  : _comm(comm),
+    _safety_factor(solver_options.GetOptionalNumericParam<double>("ToleranceSafetyFactor", 0.1)),
+    _floor(solver_options.GetOptionalNumericParam<double>(
+        "ToleranceFloor", solver_options.GetOptionalNumericParam<double>("Tolerance", 1.0e-12))),
+    _ceiling(solver_options.GetOptionalNumericParam<double>("ToleranceCeiling", 1.0e-6)),
+    _tolerance(_floor)
+{
+  if (_ceiling < _floor)
+  {
+    // The tolerance is then never loosened beyond the floor.
+    logger.warn("ToleranceCeiling ({}) is below ToleranceFloor ({}). Using the floor as ceiling.",
+                _ceiling,
+                _floor);
+    _ceiling = _floor;
+  }
+}
+
+void
+LinearTolerancePolicy::Update(double dt, const mfem::Vector & x_old, const mfem::Vector & dx_dt)
+{
+  if (!_has_previous_rate || _previous_rate.Size() != dx_dt.Size())
+  {
+    _previous_rate = dx_dt;
+    _has_previous_rate = true;
+    return;
+  }
+
+  // Backward Euler: LTE ≈ dt²/2 |x''| ≈ dt/2 |dX/dt_{n+1} - dX/dt_{n}|.
+  _difference.SetSize(dx_dt.Size());
+  mfem::subtract(dx_dt, _previous_rate, _difference);
+  const double lte = 0.5 * dt * mfem::ParNormlp(_difference, 2, _comm);
+
+  // |X_{n+1}| = |X_{n} + dt dX/dt_{n+1}|, reusing the difference vector as scratch.
+  mfem::add(x_old, dt, dx_dt, _difference);
+  const double x_norm = mfem::ParNormlp(_difference, 2, _comm);
+
+  _truncation_error = (x_norm > 0.0) ? lte / x_norm : 0.0;
+  _tolerance = std::clamp(_safety_factor * _truncation_error, _floor, _ceiling);
+
+  _previous_rate = dx_dt;
+
+  logger.debug("Estimated relative truncation error {:.3e}; next linear tolerance {:.3e}",
+               _truncation_error,
+               _tolerance);
+}
+
+bool
+LinearTolerancePolicy::SetRelativeTolerance(mfem::Solver & solver, double tolerance)
+{
+  if (auto * autotune = dynamic_cast<hephaestus::AutotuneSolver *>(&solver))
+  {
+    return autotune->SetRelativeTolerance(tolerance);
+  }
+  else if (auto * iterative = dynamic_cast<mfem::IterativeSolver *>(&solver))
+  {
+    iterative->SetRelTol(tolerance);
+  }
+  else if (auto * pcg = dynamic_cast<mfem::HyprePCG *>(&solver))
+  {
+    pcg->SetTol(tolerance);
+  }
+  else if (auto * gmres = dynamic_cast<mfem::HypreGMRES *>(&solver))
+  {
+    gmres->SetTol(tolerance);
+  }
+  else if (auto * fgmres = dynamic_cast<mfem::HypreFGMRES *>(&solver))
+  {
+    fgmres->SetTol(tolerance);
+  }
+  else
+  {
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace hephaestus
@@ -0,0 +1,54 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "inputs.hpp"
+
+namespace hephaestus
+{
+
+/// Error-balanced relative tolerance for the linear solves of an implicit time integrator.
+///
+/// After each backward Euler step the relative local truncation error is estimated from the change
+/// in the time derivative, dt/2 ||dX/dt_{n+1} - dX/dt_{n}|| / ||X_{n+1}||. The tolerance of the
+/// next linear solve is this estimate times a safety factor, clamped to [floor, ceiling]. The
+/// first step, which has no estimate, uses the floor.
+///
+/// Used by time domain equation system operators when the "AdaptiveTolerance" solver option is
+/// set. Solver options: "ToleranceSafetyFactor" (default 0.1), "ToleranceFloor" (defaults to the
+/// "Tolerance" option, or 1e-12) and "ToleranceCeiling" (default 1e-6). A ceiling below the floor
+/// is raised to the floor.
+class LinearTolerancePolicy
+{
+public:
+  LinearTolerancePolicy(const hephaestus::InputParameters & solver_options, MPI_Comm comm);
+
+  /// Updates the truncation error estimate from the state at the start of the step and the
+  /// time derivative just computed. Both are true DOF vectors, so that the norms do not depend on
+  /// the partition.
+  void Update(double dt, const mfem::Vector & x_old, const mfem::Vector & dx_dt);
+
+  /// Relative tolerance to use for the next linear solve.
+  [[nodiscard]] double GetTolerance() const { return _tolerance; }
+
+  /// Most recent relative truncation error estimate (zero before the second step).
+  [[nodiscard]] double GetTruncationErrorEstimate() const { return _truncation_error; }
+
+  /// Sets the relative tolerance on @a solver, or on the candidates of an AutotuneSolver. Returns
+  /// false for solvers whose tolerance cannot be changed (e.g. direct solvers).
+  static bool SetRelativeTolerance(mfem::Solver & solver, double tolerance);
+
+private:
+  MPI_Comm _comm;
+
+  double _safety_factor;
+  double _floor;
+  double _ceiling;
+
+  double _tolerance;
+  double _truncation_error{0.0};
+
+  mfem::Vector _previous_rate;
+  mfem::Vector _difference;
+  bool _has_previous_rate{false};
+};
+
+} // namespace hephaestus
@@ -0,0 +1,147 @@
+#include "nested_iteration.hpp"
+
+namespace hephaestus
+{
+
+HCurlNestedIteration::HCurlNestedIteration(
+    const hephaestus::InputParameters & params,
+    const std::vector<std::shared_ptr<mfem::ParMesh>> & meshes,
+    mfem::ParFiniteElementSpace * edge_fespace)
+  : _edge_fespace(edge_fespace),
+    _meshes(meshes),
+    _tol(params.GetOptionalNumericParam<double>("NestedIterationTolerance", 1.0e-2)),
+    _max_iter(params.GetOptionalParam<unsigned int>("NestedIterationMaxIter", 20)),
+    _print_level(params.GetOptionalParam<int>("PrintLevel", GetGlobalPrintLevel()))
+{
+  BuildHierarchy();
+}
+
+void
+HCurlNestedIteration::BuildHierarchy()
+{
+  if (_meshes.empty() || _meshes.back().get() != _edge_fespace->GetParMesh())
+  {
+    MFEM_ABORT("The finest mesh of the nested iteration hierarchy must be the edge space mesh.");
+  }
+
+  // Build the coarse spaces. The fine space is borrowed from the problem.
+  for (size_t level = 0; level + 1 < _meshes.size(); ++level)
+  {
+    _owned_fespaces.push_back(std::make_unique<mfem::ParFiniteElementSpace>(
+        _meshes[level].get(), _edge_fespace->FEColl()));
+    _level_fespaces.push_back(_owned_fespaces.back().get());
+  }
+  _level_fespaces.push_back(_edge_fespace);
+
+  // Each mesh is a uniform refinement of the one below, so the spaces are nested and the
+  // prolongation is the interpolation from the refinement transformations.
+  for (size_t level = 0; level + 1 < _level_fespaces.size(); ++level)
+  {
+    mfem::OperatorHandle transfer(mfem::Operator::Hypre_ParCSR);
+    _level_fespaces[level + 1]->GetTrueTransferOperator(*_level_fespaces[level], transfer);
+    transfer.SetOperatorOwner(false);
+    _prolongations.emplace_back(transfer.As<mfem::HypreParMatrix>());
+  }
+
+  logger.info("Built H(curl) nested iteration hierarchy with {} levels", _level_fespaces.size());
+}
+
+void
+HCurlNestedIteration::SetOperator(const mfem::HypreParMatrix & fine_op,
+                                  const mfem::Array<int> & ess_bdr)
+{
+  spdlog::stopwatch sw;
+
+  const size_t num_levels = _level_fespaces.size();
+
+  _level_ess_tdofs.assign(num_levels, mfem::Array<int>());
+  _level_fespaces.back()->GetEssentialTrueDofs(ess_bdr, _level_ess_tdofs.back());
+
+  _owned_operators.clear();
+  _level_operators.assign(num_levels, nullptr);
+  _level_operators.back() = &fine_op;
+
+  // Galerkin coarse operators. Corrections vanish on essential DOFs, so these are eliminated on
+  // every level.
+  for (size_t level = num_levels - 1; level > 0; --level)
+  {
+    auto coarse_op = std::unique_ptr<mfem::HypreParMatrix>(
+        mfem::RAP(_level_operators[level], _prolongations[level - 1].get()));
+
+    _level_fespaces[level - 1]->GetEssentialTrueDofs(ess_bdr, _level_ess_tdofs[level - 1]);
+    std::unique_ptr<mfem::HypreParMatrix> eliminated(
+        coarse_op->EliminateRowsCols(_level_ess_tdofs[level - 1]));
+
+    _owned_operators.push_back(std::move(coarse_op));
+    _level_operators[level - 1] = _owned_operators.back().get();
+  }
+
+  _preconditioners.clear();
+  _solvers.clear();
+  for (size_t level = 0; level + 1 < num_levels; ++level)
+  {
+    auto ams = std::make_unique<mfem::HypreAMS>(*_level_operators[level], _level_fespaces[level]);
+    ams->SetSingularProblem();
+    ams->SetPrintLevel(-1);
+
+    auto solver = std::make_unique<mfem::HyprePCG>(*_level_operators[level]);
+    solver->SetTol(_tol);
+    solver->SetMaxIter(_max_iter);
+    solver->SetPrintLevel(_print_level);
+    solver->SetPreconditioner(*ams);
+    solver->iterative_mode = (level > 0);
+
+    _preconditioners.push_back(std::move(ams));
+    _solvers.push_back(std::move(solver));
+  }
+
+  _residuals.resize(num_levels);
+  _corrections.resize(num_levels);
+  for (size_t level = 0; level < num_levels; ++level)
+  {
+    _residuals[level].SetSize(_level_operators[level]->Height());
+    _corrections[level].SetSize(_level_operators[level]->Height());
+  }
+
+  logger.info("{} SetOperator: {} seconds", typeid(this).name(), sw);
+}
+
+void
+HCurlNestedIteration::Mult(const mfem::Vector & b, mfem::Vector & x) const
+{
+  if (_level_operators.empty())
+  {
+    MFEM_ABORT("HCurlNestedIteration::SetOperator must be called before Mult.");
+  }
+
+  spdlog::stopwatch sw;
+
+  const size_t fine = _level_operators.size() - 1;
+
+  // Restrict the residual of the initial guess down the hierarchy.
+  _level_operators[fine]->Mult(x, _residuals[fine]);
+  mfem::subtract(b, _residuals[fine], _residuals[fine]);
+  _residuals[fine].SetSubVector(_level_ess_tdofs[fine], 0.0);
+
+  for (size_t level = fine; level > 0; --level)
+  {
+    _prolongations[level - 1]->MultTranspose(_residuals[level], _residuals[level - 1]);
+    _residuals[level - 1].SetSubVector(_level_ess_tdofs[level - 1], 0.0);
+  }
+
+  // Solve on the coarsest level, then use each prolonged correction as the initial guess on the
+  // next finer level.
+  _corrections[0] = 0.0;
+  for (size_t level = 0; level < fine; ++level)
+  {
+    _solvers[level]->Mult(_residuals[level], _corrections[level]);
+    _prolongations[level]->Mult(_corrections[level], _corrections[level + 1]);
+  }
+
+  _corrections[fine].SetSubVector(_level_ess_tdofs[fine], 0.0);
+  x += _corrections[fine];
+
+  logger.info("{} Mult: {} seconds", typeid(this).name(), sw);
+}
+
+} // namespace hephaestus
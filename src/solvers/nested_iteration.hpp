@@ -0,0 +1,80 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+#include "inputs.hpp"
+
+namespace hephaestus
+{
+
+/// Nested iteration (full multigrid style startup) for H(curl) systems on a hierarchy of uniformly
+/// refined meshes.
+///
+/// The hierarchy reuses the finite element collection of the fine edge space on each coarser mesh,
+/// so the spaces are nested and the prolongations are the exact interpolation between levels.
+/// Coarse operators are formed algebraically (Galerkin RAP) from the fine operator passed in
+/// @a SetOperator. @a Mult solves for the fine residual on the coarsest level, then prolongs the
+/// correction to each finer level where it is used as the initial guess of a loosely converged
+/// AMS-preconditioned PCG solve. The result is an improved initial guess for the fine solve.
+class HCurlNestedIteration
+{
+public:
+  /// @a meshes holds the hierarchy ordered from the coarsest to the finest mesh; the finest mesh
+  /// must be the mesh of @a edge_fespace.
+  HCurlNestedIteration(const hephaestus::InputParameters & params,
+                       const std::vector<std::shared_ptr<mfem::ParMesh>> & meshes,
+                       mfem::ParFiniteElementSpace * edge_fespace);
+
+  ~HCurlNestedIteration() = default;
+
+  /// Builds the coarse operators and solvers from the fine operator, with essential DOFs on
+  /// @a ess_bdr eliminated on every level.
+  void SetOperator(const mfem::HypreParMatrix & fine_op, const mfem::Array<int> & ess_bdr);
+
+  /// Improves the initial guess @a x of the fine system with right-hand side @a b. Essential DOFs
+  /// of @a x are left unchanged.
+  void Mult(const mfem::Vector & b, mfem::Vector & x) const;
+
+  /// Returns the number of levels in the hierarchy (including the fine level).
+  [[nodiscard]] int NumLevels() const { return static_cast<int>(_level_fespaces.size()); }
+
+  /// Returns the edge space on @a level. Level 0 is the coarsest.
+  [[nodiscard]] mfem::ParFiniteElementSpace * GetFESpace(int level) const
+  {
+    return _level_fespaces.at(level);
+  }
+
+  /// Returns the true DOF prolongation from @a level to @a level + 1.
+  [[nodiscard]] const mfem::HypreParMatrix & GetProlongation(int level) const
+  {
+    return *_prolongations.at(level);
+  }
+
+private:
+  void BuildHierarchy();
+
+  mfem::ParFiniteElementSpace * _edge_fespace{nullptr};
+  std::vector<std::shared_ptr<mfem::ParMesh>> _meshes;
+
+  double _tol;
+  int _max_iter;
+  int _print_level;
+
+  // Level 0 is the coarsest space; the last level is the user's edge space.
+  std::vector<std::unique_ptr<mfem::ParFiniteElementSpace>> _owned_fespaces;
+  std::vector<mfem::ParFiniteElementSpace *> _level_fespaces;
+
+  // _prolongations[l] maps true dofs on level l to true dofs on level l + 1.
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> _prolongations;
+
+  std::vector<std::unique_ptr<mfem::HypreParMatrix>> _owned_operators;
+  std::vector<const mfem::HypreParMatrix *> _level_operators;
+  std::vector<mfem::Array<int>> _level_ess_tdofs;
+
+  // Solvers for the coarse levels; the fine level is solved by the caller.
+  std::vector<std::unique_ptr<mfem::HypreAMS>> _preconditioners;
+  std::vector<std::unique_ptr<mfem::HyprePCG>> _solvers;
+
+  mutable std::vector<mfem::Vector> _residuals;
+  mutable std::vector<mfem::Vector> _corrections;
+};
+
+} // namespace hephaestus
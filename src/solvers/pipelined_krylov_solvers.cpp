@@ -0,0 +1,369 @@
+#include "pipelined_krylov_solvers.hpp"
+
+namespace hephaestus
+{
+
+namespace
+{
+
+void
+GeneratePlaneRotation(double dx, double dy, double & cs, double & sn)
+{
+  if (dy == 0.0)
+  {
+    cs = 1.0;
+    sn = 0.0;
+  }
+  else if (std::fabs(dy) > std::fabs(dx))
+  {
+    const double temp = dx / dy;
+    sn = 1.0 / std::sqrt(1.0 + temp * temp);
+    cs = temp * sn;
+  }
+  else
+  {
+    const double temp = dy / dx;
+    cs = 1.0 / std::sqrt(1.0 + temp * temp);
+    sn = temp * cs;
+  }
+}
+
+void
+ApplyPlaneRotation(double & dx, double & dy, double cs, double sn)
+{
+  const double temp = cs * dx + sn * dy;
+  dy = -sn * dx + cs * dy;
+  dx = temp;
+}
+
+} // namespace
+
+void
+PipelinedCGSolver::ApplyPreconditioner(const mfem::Vector & x, mfem::Vector & y) const
+{
+  if (prec)
+  {
+    prec->Mult(x, y);
+  }
+  else
+  {
+    y = x;
+  }
+}
+
+void
+PipelinedCGSolver::Mult(const mfem::Vector & b, mfem::Vector & x) const
+{
+  const int size = b.Size();
+  for (auto * vec : {&_r, &_u, &_w, &_m, &_n, &_p, &_s, &_q, &_z})
+  {
+    vec->SetSize(size);
+  }
+
+  if (iterative_mode)
+  {
+    oper->Mult(x, _r);
+    mfem::subtract(b, _r, _r);
+  }
+  else
+  {
+    x = 0.0;
+    _r = b;
+  }
+
+  ApplyPreconditioner(_r, _u);
+  oper->Mult(_u, _w);
+
+  _p = 0.0;
+  _s = 0.0;
+  _q = 0.0;
+  _z = 0.0;
+
+  converged = false;
+  final_iter = max_iter;
+
+  double gamma_old = 0.0;
+  double alpha_old = 0.0;
+  double target = 0.0;
+
+  for (int i = 0; i <= max_iter; ++i)
+  {
+    // Fused, non-blocking reduction of (r, u) and (w, u).
+    double local_dots[2] = {_r * _u, _w * _u};
+    double global_dots[2];
+    MPI_Request request;
+    MPI_Iallreduce(local_dots, global_dots, 2, MPI_DOUBLE, MPI_SUM, comm, &request);
+
+    // Overlap the reduction with the preconditioner and operator application.
+    ApplyPreconditioner(_w, _m);
+    oper->Mult(_m, _n);
+
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+    const double gamma = global_dots[0];
+    const double delta = global_dots[1];
+
+    if (i == 0)
+    {
+      target = std::max(gamma * rel_tol * rel_tol, abs_tol * abs_tol);
+    }
+
+    if (print_options.iterations)
+    {
+      mfem::out << "   Iteration : " << std::setw(3) << i << "  (B r, r) = " << gamma << '\n';
+    }
+
+    final_norm = std::sqrt(std::fabs(gamma));
+
+    if (gamma <= target)
+    {
+      converged = true;
+      final_iter = i;
+      break;
+    }
+
+    if (i == max_iter)
+    {
+      break;
+    }
+
+    double alpha, beta;
+    if (i > 0)
+    {
+      beta = gamma / gamma_old;
+      alpha = gamma / (delta - beta * gamma / alpha_old);
+    }
+    else
+    {
+      beta = 0.0;
+      alpha = gamma / delta;
+    }
+
+    if (!std::isfinite(alpha) || alpha <= 0.0)
+    {
+      if (print_options.warnings)
+      {
+        mfem::out << "PipelinedCG: breakdown at iteration " << i << '\n';
+      }
+      final_iter = i;
+      break;
+    }
+
+    mfem::add(_n, beta, _z, _z);
+    mfem::add(_m, beta, _q, _q);
+    mfem::add(_w, beta, _s, _s);
+    mfem::add(_u, beta, _p, _p);
+
+    x.Add(alpha, _p);
+    _r.Add(-alpha, _s);
+    _u.Add(-alpha, _q);
+    _w.Add(-alpha, _z);
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  if (print_options.summary || (print_options.warnings && !converged))
+  {
+    mfem::out << "PipelinedCG: Number of iterations: " << final_iter << '\n';
+  }
+  if (print_options.warnings && !converged)
+  {
+    mfem::out << "PipelinedCG: No convergence!\n";
+  }
+}
+
+void
+SingleReduceGMRESSolver::ApplyPreconditioner(const mfem::Vector & x, mfem::Vector & y) const
+{
+  if (prec)
+  {
+    prec->Mult(x, y);
+  }
+  else
+  {
+    y = x;
+  }
+}
+
+double
+SingleReduceGMRESSolver::Orthogonalise(int num_basis, mfem::Vector & w, double * h) const
+{
+  std::vector<double> local_dots(num_basis + 1);
+  std::vector<double> global_dots(num_basis + 1);
+
+  for (int k = 0; k < num_basis; ++k)
+  {
+    h[k] = 0.0;
+  }
+
+  double norm_sq = 0.0;
+
+  // At most two classical Gram-Schmidt passes ("twice is enough").
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (int k = 0; k < num_basis; ++k)
+    {
+      local_dots[k] = _basis[k] * w;
+    }
+    local_dots[num_basis] = w * w;
+
+    MPI_Allreduce(
+        local_dots.data(), global_dots.data(), num_basis + 1, MPI_DOUBLE, MPI_SUM, comm);
+
+    double projection_sq = 0.0;
+    for (int k = 0; k < num_basis; ++k)
+    {
+      w.Add(-global_dots[k], _basis[k]);
+      h[k] += global_dots[k];
+      projection_sq += global_dots[k] * global_dots[k];
+    }
+
+    // Pythagorean estimate of the orthogonalised norm; accurate unless there was significant
+    // cancellation, in which case a second pass is made.
+    norm_sq = global_dots[num_basis] - projection_sq;
+    if (norm_sq > 0.5 * global_dots[num_basis])
+    {
+      break;
+    }
+  }
+
+  return norm_sq;
+}
+
+void
+SingleReduceGMRESSolver::Mult(const mfem::Vector & b, mfem::Vector & x) const
+{
+  const int size = b.Size();
+  _r.SetSize(size);
+  _w.SetSize(size);
+  _z.SetSize(size);
+
+  _basis.resize(_k_dim + 1);
+  for (auto & vec : _basis)
+  {
+    vec.SetSize(size);
+  }
+
+  mfem::DenseMatrix hessenberg(_k_dim + 1, _k_dim);
+  mfem::Vector s(_k_dim + 1), cs(_k_dim), sn(_k_dim), y(_k_dim);
+
+  if (iterative_mode)
+  {
+    oper->Mult(x, _r);
+    mfem::subtract(b, _r, _r);
+  }
+  else
+  {
+    x = 0.0;
+    _r = b;
+  }
+
+  double beta = Norm(_r);
+  const double target = std::max(rel_tol * beta, abs_tol);
+
+  if (print_options.iterations)
+  {
+    mfem::out << "   Pass : " << std::setw(2) << 1 << "   Iteration : " << std::setw(3) << 0
+              << "  ||r|| = " << beta << '\n';
+  }
+
+  converged = (beta <= target);
+  int iter = 0;
+  int pass = 1;
+
+  while (!converged && iter < max_iter)
+  {
+    _basis[0].Set(1.0 / beta, _r);
+    s = 0.0;
+    s(0) = beta;
+
+    double resid = beta;
+    int i = 0;
+    while (i < _k_dim && iter < max_iter)
+    {
+      ApplyPreconditioner(_basis[i], _z);
+      oper->Mult(_z, _w);
+
+      const double h_next_sq = Orthogonalise(i + 1, _w, hessenberg.GetColumn(i));
+      const double h_next = std::sqrt(std::max(h_next_sq, 0.0));
+      hessenberg(i + 1, i) = h_next;
+
+      if (h_next > 0.0)
+      {
+        _basis[i + 1].Set(1.0 / h_next, _w);
+      }
+
+      for (int k = 0; k < i; ++k)
+      {
+        ApplyPlaneRotation(hessenberg(k, i), hessenberg(k + 1, i), cs(k), sn(k));
+      }
+      GeneratePlaneRotation(hessenberg(i, i), hessenberg(i + 1, i), cs(i), sn(i));
+      ApplyPlaneRotation(hessenberg(i, i), hessenberg(i + 1, i), cs(i), sn(i));
+      ApplyPlaneRotation(s(i), s(i + 1), cs(i), sn(i));
+
+      resid = std::fabs(s(i + 1));
+      ++i;
+      ++iter;
+
+      if (print_options.iterations)
+      {
+        mfem::out << "   Pass : " << std::setw(2) << pass << "   Iteration : " << std::setw(3)
+                  << iter << "  ||r|| = " << resid << '\n';
+      }
+
+      // Converged, or the Krylov space is invariant (lucky breakdown).
+      if (resid <= target || h_next == 0.0)
+      {
+        break;
+      }
+    }
+
+    // Solve the upper triangular least-squares system and apply the update x += M V y.
+    for (int k = i - 1; k >= 0; --k)
+    {
+      y(k) = s(k);
+      for (int l = k + 1; l < i; ++l)
+      {
+        y(k) -= hessenberg(k, l) * y(l);
+      }
+      y(k) /= hessenberg(k, k);
+    }
+
+    _w = 0.0;
+    for (int k = 0; k < i; ++k)
+    {
+      _w.Add(y(k), _basis[k]);
+    }
+    ApplyPreconditioner(_w, _z);
+    x += _z;
+
+    if (resid <= target)
+    {
+      beta = resid;
+      converged = true;
+      break;
+    }
+
+    // Restart from the true residual.
+    oper->Mult(x, _r);
+    mfem::subtract(b, _r, _r);
+    beta = Norm(_r);
+    converged = (beta <= target);
+    ++pass;
+  }
+
+  final_iter = iter;
+  final_norm = beta;
+
+  if (print_options.summary || (print_options.warnings && !converged))
+  {
+    mfem::out << "SingleReduceGMRES: Number of iterations: " << final_iter << '\n';
+  }
+  if (print_options.warnings && !converged)
+  {
+    mfem::out << "SingleReduceGMRES: No convergence!\n";
+  }
+}
+
+} // namespace hephaestus
@@ -0,0 +1,57 @@
+#pragma once
+#include "../common/pfem_extras.hpp"
+
+namespace hephaestus
+{
+
+/// Preconditioned pipelined conjugate gradient (Ghysels & Vanroose, 2014).
+///
+/// The two inner products of each iteration are fused into a single non-blocking reduction which
+/// is overlapped with the preconditioner and operator application, so each iteration has one
+/// global synchronisation hidden behind local work. Convergence is checked on the preconditioned
+/// residual norm (r, Mr), as in mfem::CGSolver.
+class PipelinedCGSolver : public mfem::IterativeSolver
+{
+public:
+  PipelinedCGSolver(MPI_Comm comm) : mfem::IterativeSolver(comm) {}
+
+  ~PipelinedCGSolver() override = default;
+
+  void Mult(const mfem::Vector & b, mfem::Vector & x) const override;
+
+private:
+  void ApplyPreconditioner(const mfem::Vector & x, mfem::Vector & y) const;
+
+  mutable mfem::Vector _r, _u, _w, _m, _n, _p, _s, _q, _z;
+};
+
+/// Restarted, right-preconditioned GMRES using classical Gram-Schmidt with the new vector's norm
+/// fused into the same reduction. Each Arnoldi step therefore costs a single global reduction
+/// instead of the i + 2 needed by modified Gram-Schmidt. A second orthogonalisation pass is made
+/// only when cancellation is detected.
+class SingleReduceGMRESSolver : public mfem::IterativeSolver
+{
+public:
+  SingleReduceGMRESSolver(MPI_Comm comm) : mfem::IterativeSolver(comm) {}
+
+  ~SingleReduceGMRESSolver() override = default;
+
+  /// Set the number of iterations between restarts.
+  void SetKDim(int dim) { _k_dim = dim; }
+
+  void Mult(const mfem::Vector & b, mfem::Vector & x) const override;
+
+private:
+  void ApplyPreconditioner(const mfem::Vector & x, mfem::Vector & y) const;
+
+  /// Orthogonalises w against the first @a num_basis vectors of the Krylov basis, accumulating
+  /// the projection coefficients into @a h. Returns the squared norm of the result.
+  double Orthogonalise(int num_basis, mfem::Vector & w, double * h) const;
+
+  int _k_dim{50};
+
+  mutable std::vector<mfem::Vector> _basis;
+  mutable mfem::Vector _r, _w, _z;
+};
+
+} // namespace hephaestus
@@ -43,7 +43,8 @@ ClosedCoilSolver::ClosedCoilSolver(std::string source_efield_gf_name,
     _i_coef_name(std::move(i_coef_name)),
     _cond_coef_name(std::move(cond_coef_name)),
     _electric_field_transfer(std::move(electric_field_transfer)),
-    _coil_domains(std::move(coil_dom))
+    _coil_domains(std::move(coil_dom)),
+    _solver_options(std::move(solver_options))
 {
   _elec_attrs.first = electrode_face;
 }
@@ -157,6 +158,20 @@ ClosedCoilSolver::Init(hephaestus::GridFunctions & gridfunctions,
   SolveTransition();
   SolveCoil();
   RestoreAttributes();
+
+  if (_source_current_density)
+  {
+    hephaestus::GridFunctions aux_gf;
+    aux_gf.Register("source_electric_field", _source_electric_field);
+    aux_gf.Register("source_current_density", _source_current_density);
+
+    hephaestus::Coefficients aux_coef;
+    aux_coef._scalars.Register("electrical_conductivity", _sigma);
+
+    _current_density_auxsolver = std::make_unique<hephaestus::ScaledVectorGridFunctionAux>(
+        "source_electric_field", "source_current_density", "electrical_conductivity", 1.0);
+    _current_density_auxsolver->Init(aux_gf, aux_coef);
+  }
 }
 
 void
@@ -177,19 +192,9 @@ ClosedCoilSolver::Apply(mfem::ParLinearForm * lf)
     _source_electric_field->Add(i, *_electric_field_t_parent);
   }
 
-  if (_source_current_density)
+  if (_current_density_auxsolver)
   {
-    hephaestus::GridFunctions aux_gf;
-    aux_gf.Register("source_electric_field", _source_electric_field);
-    aux_gf.Register("source_current_density", _source_current_density);
-
-    hephaestus::Coefficients aux_coef;
-    aux_coef._scalars.Register("electrical_conductivity", _sigma);
-
-    hephaestus::ScaledVectorGridFunctionAux current_density_auxsolver(
-        "source_electric_field", "source_current_density", "electrical_conductivity", 1.0);
-    current_density_auxsolver.Init(aux_gf, aux_coef);
-    current_density_auxsolver.Solve();
+    _current_density_auxsolver->Solve();
   }
 }
 
@@ -368,10 +373,11 @@ ClosedCoilSolver::AddWedgeToPWCoefs(std::vector<int> & wedge_els)
 
   // Gather all has_els info from the processes to determine the lowest rank that contains wedge
   // elements
-  bool * all_has_els = (bool *)malloc(sizeof(bool) * mfem::Mpi::WorldSize());
-  MPI_Allgather(&has_els, 1, MPI_CXX_BOOL, all_has_els, 1, MPI_CXX_BOOL, MPI_COMM_WORLD);
+  bool * all_has_els = (bool *)malloc(sizeof(bool) * _mesh_parent->GetNRanks());
+  MPI_Allgather(
+      &has_els, 1, MPI_CXX_BOOL, all_has_els, 1, MPI_CXX_BOOL, _mesh_parent->GetComm());
 
-  for (int i = 0; i < mfem::Mpi::WorldSize(); ++i)
+  for (int i = 0; i < _mesh_parent->GetNRanks(); ++i)
   {
     if (all_has_els[i] == true)
     {
@@ -384,10 +390,10 @@ ClosedCoilSolver::AddWedgeToPWCoefs(std::vector<int> & wedge_els)
 
   free(all_has_els);
 
-  if (mfem::Mpi::WorldRank() == ref_rank)
+  if (_mesh_parent->GetMyRank() == ref_rank)
     wedge_old_att = _mesh_parent->GetAttribute(wedge_els[0]);
 
-  MPI_Bcast(&wedge_old_att, 1, MPI_INT, ref_rank, MPI_COMM_WORLD);
+  MPI_Bcast(&wedge_old_att, 1, MPI_INT, ref_rank, _mesh_parent->GetComm());
 
   // Now we check in which of the old subdomains the wedge lies
   int sd_wedge = -1;
@@ -562,10 +568,11 @@ ClosedCoilSolver::SolveCoil()
   bool has_els = (bool)_mesh_coil->GetNE();
 
   // Gather all has_els info from the processes
-  bool * all_has_els = (bool *)malloc(sizeof(bool) * mfem::Mpi::WorldSize());
-  MPI_Allgather(&has_els, 1, MPI_CXX_BOOL, all_has_els, 1, MPI_CXX_BOOL, MPI_COMM_WORLD);
+  bool * all_has_els = (bool *)malloc(sizeof(bool) * _mesh_parent->GetNRanks());
+  MPI_Allgather(
+      &has_els, 1, MPI_CXX_BOOL, all_has_els, 1, MPI_CXX_BOOL, _mesh_parent->GetComm());
 
-  for (int i = 0; i < mfem::Mpi::WorldSize(); ++i)
+  for (int i = 0; i < _mesh_parent->GetNRanks(); ++i)
   {
     if (all_has_els[i] == true)
     {
@@ -578,7 +585,7 @@ ClosedCoilSolver::SolveCoil()
 
   free(all_has_els);
 
-  if (mfem::Mpi::WorldRank() == ref_rank)
+  if (_mesh_parent->GetMyRank() == ref_rank)
   {
     ess_bdr_tdofs_coil.SetSize(1);
     ess_bdr_tdofs_coil[0] = 0;
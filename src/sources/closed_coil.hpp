@@ -24,8 +24,8 @@ public:
                    bool electric_field_transfer = false,
                    std::string source_jfield_gf_name = "",
                    hephaestus::InputParameters solver_options =
-                       hephaestus::InputParameters({{"Tolerance", float(1.0e-18)},
-                                                    {"AbsTolerance", float(1.0e-18)},
+                       hephaestus::InputParameters({{"Tolerance", float(1.0e-12)},
+                                                    {"AbsTolerance", float(1.0e-16)},
                                                     {"MaxIter", (unsigned int)1000},
                                                     {"PrintLevel", GetGlobalPrintLevel()}}));
 
@@ -129,6 +129,9 @@ private:
 
   // Final LinearForm
   std::unique_ptr<mfem::ParLinearForm> _final_lf{nullptr};
+
+  // Computes the source current density from the source electric field, if requested
+  std::unique_ptr<hephaestus::ScaledVectorGridFunctionAux> _current_density_auxsolver{nullptr};
 };
 
 class Plane3D
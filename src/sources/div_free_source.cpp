@@ -1,5 +1,4 @@
 #include "div_free_source.hpp"
-#include "helmholtz_projector.hpp"
 
 namespace hephaestus
 {
@@ -28,6 +27,7 @@ DivFreeSource::DivFreeSource(std::string src_coef_name,
     _h1_fespace_name(std::move(h1_fespace_name)),
     _potential_gf_name(std::move(potential_gf_name)),
     _solver_options(std::move(solver_options)),
+    _solver_params(hephaestus::LinearSolverParams::Parse(_solver_options)),
     _perform_helmholtz_projection(std::move(perform_helmholtz_projection)),
     _h_curl_mass(nullptr)
 {
@@ -57,6 +57,17 @@ DivFreeSource::Init(hephaestus::GridFunctions & gridfunctions,
   _fespaces = &fespaces;
 
   BuildHCurlMass();
+
+  if (_perform_helmholtz_projection)
+  {
+    hephaestus::InputParameters projector_pars;
+    projector_pars.SetParam("VectorGridFunctionName", _src_gf_name);
+    projector_pars.SetParam("ScalarGridFunctionName", _potential_gf_name);
+    projector_pars.SetParam("H1FESpaceName", _h1_fespace_name);
+    projector_pars.SetParam("HCurlFESpaceName", _hcurl_fespace_name);
+
+    _projector = std::make_unique<hephaestus::HelmholtzProjector>(projector_pars);
+  }
 }
 
 void
@@ -82,7 +93,7 @@ DivFreeSource::Apply(mfem::ParLinearForm * lf)
     mfem::Array<int> ess_tdof_list;
     _h_curl_mass->FormLinearSystem(ess_tdof_list, *_g, j, m, x, rhs);
 
-    DefaultGMRESSolver solver(_solver_options, m);
+    DefaultGMRESSolver solver(_solver_params, m);
     solver.Mult(rhs, x);
 
     _h_curl_mass->RecoverFEMSolution(x, j, *_g);
@@ -90,19 +101,9 @@ DivFreeSource::Apply(mfem::ParLinearForm * lf)
 
   *_div_free_src_gf = *_g;
 
-  if (_perform_helmholtz_projection)
+  if (_projector)
   {
-
-    hephaestus::InputParameters projector_pars;
-    projector_pars.SetParam("VectorGridFunctionName", _src_gf_name);
-    projector_pars.SetParam("ScalarGridFunctionName", _potential_gf_name);
-    projector_pars.SetParam("H1FESpaceName", _h1_fespace_name);
-    projector_pars.SetParam("HCurlFESpaceName", _hcurl_fespace_name);
-
-    hephaestus::BCMap bcs;
-
-    hephaestus::HelmholtzProjector projector(projector_pars);
-    projector.Project(*_gridfunctions, *_fespaces, bcs);
+    _projector->Project(*_gridfunctions, *_fespaces, _projector_bcs);
   }
 
   // Add divergence free source to target linear form
@@ -1,4 +1,5 @@
 #pragma once
+#include "helmholtz_projector.hpp"
 #include "source_base.hpp"
 
 namespace hephaestus
@@ -32,6 +33,7 @@ public:
   std::string _hcurl_fespace_name;
   std::string _h1_fespace_name;
   const hephaestus::InputParameters _solver_options;
+  const hephaestus::LinearSolverParams _solver_params;
   bool _perform_helmholtz_projection;
 
   mfem::ParFiniteElementSpace * _h1_fe_space{nullptr};
@@ -54,6 +56,11 @@ public:
   std::shared_ptr<mfem::ParGridFunction> _div_free_src_gf;
 
   mfem::Solver * _solver{nullptr};
+
+  // Helmholtz projection of the source, created once in Init
+  std::unique_ptr<hephaestus::HelmholtzProjector> _projector{nullptr};
+  // BCs of the projection, kept between applications so the projector can reuse its forms.
+  hephaestus::BCMap _projector_bcs;
 };
 
 } // namespace hephaestus
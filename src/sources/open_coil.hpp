@@ -38,8 +38,8 @@ public:
                  bool electric_field_transfer = true,
                  std::string source_jfield_gf_name = "",
                  hephaestus::InputParameters solver_options =
-                     hephaestus::InputParameters({{"Tolerance", float(1.0e-20)},
-                                                  {"AbsTolerance", float(1.0e-20)},
+                     hephaestus::InputParameters({{"Tolerance", float(1.0e-12)},
+                                                  {"AbsTolerance", float(1.0e-16)},
                                                   {"MaxIter", (unsigned int)1000},
                                                   {"PrintLevel", GetGlobalPrintLevel()}}));
 
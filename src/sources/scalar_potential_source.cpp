@@ -60,18 +60,24 @@ ScalarPotentialSource::Init(hephaestus::GridFunctions & gridfunctions,
 
   _beta_coef = coefficients._scalars.Get(_coef_name);
 
+  _static_condensation = _solver_options.GetOptionalParam<bool>("StaticCondensation", false);
+
   _a0 = std::make_unique<mfem::ParBilinearForm>(_h1_fe_space);
   _a0->AddDomainIntegrator(new mfem::DiffusionIntegrator(*_beta_coef));
+  if (_static_condensation)
+  {
+    _a0->EnableStaticCondensation();
+  }
   _a0->Assemble();
 
   BuildGrad();
   BuildM1(_beta_coef);
   // a0(p, p') = (β ∇ p, ∇ p')
 
-  _b0 = std::make_unique<mfem::ParLinearForm>(_h1_fe_space);
   _diffusion_mat = std::make_unique<mfem::HypreParMatrix>();
   _p_tdofs = std::make_unique<mfem::Vector>();
   _b0_tdofs = std::make_unique<mfem::Vector>();
+  _phi_bc = std::make_unique<mfem::ParGridFunction>(_h1_fe_space);
 }
 
 ScalarPotentialSource::~ScalarPotentialSource() = default;
@@ -103,16 +109,27 @@ ScalarPotentialSource::Apply(mfem::ParLinearForm * lf)
   // a0(p_{n+1}, p') = b0(p')
   // a0(p, p') = (β ∇ p, ∇ p')
   // b0(p') = <n.s0, p'>
-  mfem::ParGridFunction phi_gf(_h1_fe_space);
+  mfem::ParGridFunction & phi_gf = *_phi_bc;
   mfem::Array<int> poisson_ess_tdof_list;
   phi_gf = 0.0;
-  *_b0 = 0.0;
   _bc_map->ApplyEssentialBCs(
       _phi_gf_name, poisson_ess_tdof_list, phi_gf, (_h1_fe_space->GetParMesh()));
-  _bc_map->ApplyIntegratedBCs(_phi_gf_name, *_b0, (_h1_fe_space->GetParMesh()));
+  // Each application of the integrated BCs adds integrators to the form, so they are added once
+  // and again to a new form only if the BCs change.
+  if (_b0 == nullptr || _b0_bc_revision != _bc_map->GetRevision())
+  {
+    _b0 = std::make_unique<mfem::ParLinearForm>(_h1_fe_space);
+    _bc_map->ApplyIntegratedBCs(_phi_gf_name, *_b0, (_h1_fe_space->GetParMesh()));
+    _b0_bc_revision = _bc_map->GetRevision();
+  }
   _b0->Assemble();
 
   _a0->Update();
+  // Update discards the condensed system.
+  if (_static_condensation)
+  {
+    _a0->EnableStaticCondensation();
+  }
   _a0->Assemble();
   _a0->FormLinearSystem(
       poisson_ess_tdof_list, phi_gf, *_b0, *_diffusion_mat, *_p_tdofs, *_b0_tdofs);
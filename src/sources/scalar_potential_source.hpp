@@ -46,6 +46,8 @@ public:
 
   std::unique_ptr<mfem::ParBilinearForm> _a0{nullptr};
   std::unique_ptr<mfem::ParBilinearForm> _m1{nullptr};
+  // Whether the interior DOFs of the potential are condensed from _a0.
+  bool _static_condensation{false};
 
   mfem::ParBilinearForm * _h_curl_mass;
   mfem::ParMixedBilinearForm * _weak_div{nullptr};
@@ -55,11 +57,15 @@ public:
   std::unique_ptr<mfem::HypreParMatrix> _diffusion_mat{nullptr};
   std::unique_ptr<mfem::Vector> _p_tdofs{nullptr};
   std::unique_ptr<mfem::Vector> _b0_tdofs{nullptr};
+  // Holds the Dirichlet values of the potential between applications.
+  std::unique_ptr<mfem::ParGridFunction> _phi_bc{nullptr};
 
   mutable mfem::HypreSolver * _amg_a0{nullptr};
   mutable std::unique_ptr<hephaestus::DefaultH1PCGSolver> _a0_solver{nullptr};
 
   std::unique_ptr<mfem::ParLinearForm> _b0{nullptr};
+  // BC map revision whose integrated BCs were added to _b0.
+  std::size_t _b0_bc_revision{0};
   std::shared_ptr<mfem::ParGridFunction> _grad_phi{nullptr};
   mfem::ParGridFunction * _x_div{nullptr};
   mfem::VectorCoefficient * _source_vec_coef{nullptr};
@@ -30,6 +30,30 @@ Sources::Apply(mfem::ParLinearForm * lf)
   }
 }
 
+void
+Sources::Apply(mfem::ParLinearForm * lf,
+               hephaestus::ScratchPool & scratch,
+               std::map<std::string, const mfem::Vector *> & loads)
+{
+  loads.clear();
+  auto * fespace = lf->ParFESpace();
+  mfem::ParLinearForm source_lf(
+      fespace, scratch.GetVector("Sources::source_lf", fespace->GetVSize()).GetData());
+  for (const auto & [name, source] : *this)
+  {
+    logger.info("Applying {} Source", name);
+    spdlog::stopwatch sw;
+    source_lf = 0.0;
+    source->Apply(&source_lf);
+    *lf += source_lf;
+
+    auto & load = scratch.GetVector("Sources::load:" + name, fespace->GetTrueVSize());
+    source_lf.ParallelAssemble(load);
+    loads[name] = &load;
+    logger.info("{} Apply: {} seconds", name, sw);
+  }
+}
+
 void
 Sources::SubtractSources(mfem::ParGridFunction * gf)
 {
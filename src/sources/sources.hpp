@@ -4,6 +4,9 @@
 #include "named_fields_map.hpp"
 #include "open_coil.hpp"
 #include "scalar_potential_source.hpp"
+#include "scratch_pool.hpp"
+
+#include <map>
 
 namespace hephaestus
 {
@@ -16,6 +19,14 @@ public:
             hephaestus::BCMap & bc_map,
             hephaestus::Coefficients & coefficients);
   void Apply(mfem::ParLinearForm * lf);
+
+  /// Applies the sources to @a lf as @a Apply does, and also sets @a loads to the true DOF load
+  /// vector of each source, keyed by source name, so that the contribution of each source can be
+  /// reused later without applying it again. The load vectors and temporaries are taken from
+  /// @a scratch, and the loads remain valid until they are next set.
+  void Apply(mfem::ParLinearForm * lf,
+             hephaestus::ScratchPool & scratch,
+             std::map<std::string, const mfem::Vector *> & loads);
   void SubtractSources(mfem::ParGridFunction * gf);
 };
 
@@ -0,0 +1,58 @@
+#include "scratch_pool.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+
+namespace hephaestus
+{
+
+mfem::Vector &
+ScratchPool::GetVector(const std::string & key, int size)
+{
+  auto & vector = _vectors[key];
+
+  if (size > vector.Capacity())
+  {
+    _bytes_held -= vector.Capacity() * sizeof(double);
+    vector.Destroy();
+    vector.SetSize(size);
+    _bytes_held += vector.Capacity() * sizeof(double);
+    _peak_bytes_held = std::max(_peak_bytes_held, _bytes_held);
+    _allocations++;
+  }
+  else
+  {
+    // Shrinking a vector keeps its storage.
+    vector.SetSize(size);
+  }
+
+  _requests++;
+  _requested_bytes += size * sizeof(double);
+
+  return vector;
+}
+
+void
+ScratchPool::Clear()
+{
+  _vectors.clear();
+  _bytes_held = 0;
+}
+
+void
+ScratchPool::LogStatistics(const std::string & label) const
+{
+  constexpr double mib = 1024.0 * 1024.0;
+  const double average_request = _requests ? _requested_bytes / double(_requests) : 0.0;
+
+  logger.info("{} scratch memory: {:.2f} MiB held, {:.2f} MiB peak, {:.2f} MiB per request on "
+              "average over {} requests, {} allocations",
+              label,
+              _bytes_held / mib,
+              _peak_bytes_held / mib,
+              average_request / mib,
+              _requests,
+              _allocations);
+}
+
+} // namespace hephaestus
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "mfem.hpp"
+
+namespace hephaestus
+{
+
+/// Named scratch vectors that persist between steps.
+///
+/// Per-step temporaries (true DOF vectors, linear form storage) are requested by name. The storage
+/// behind each name is kept and reused for any later request that fits in it, so a temporary is
+/// allocated once per run rather than once per step.
+class ScratchPool
+{
+public:
+  ScratchPool() = default;
+
+  /// Returns the scratch vector for key, resized to size. Its contents are unspecified, and it
+  /// remains valid until the pool is cleared. Each caller should use its own key.
+  mfem::Vector & GetVector(const std::string & key, int size);
+
+  /// Frees all scratch storage. Statistics are kept.
+  void Clear();
+
+  [[nodiscard]] std::size_t GetBytesHeld() const { return _bytes_held; }
+  [[nodiscard]] std::size_t GetPeakBytesHeld() const { return _peak_bytes_held; }
+  [[nodiscard]] std::size_t GetAllocationCount() const { return _allocations; }
+  [[nodiscard]] std::size_t GetRequestCount() const { return _requests; }
+
+  /// Logs the held and peak storage, and the mean size of a single request, at info level.
+  void LogStatistics(const std::string & label) const;
+
+private:
+  std::map<std::string, mfem::Vector> _vectors;
+
+  std::size_t _bytes_held{0};
+  std::size_t _peak_bytes_held{0};
+  std::size_t _allocations{0};
+  std::size_t _requests{0};
+  std::size_t _requested_bytes{0};
+};
+
+} // namespace hephaestus
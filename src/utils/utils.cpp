@@ -82,4 +82,100 @@ CleanDivergence(hephaestus::GridFunctions & gfs,
   projector.Project(gfs, fes, bcs);
 }
 
+void
+SymmetricEigensystem(mfem::DenseMatrix mat,
+                     mfem::Vector & eigenvalues,
+                     mfem::DenseMatrix & vectors)
+{
+  const int size = mat.Height();
+  mfem::DenseMatrix rotated(size);
+  rotated = 0.0;
+  for (int i = 0; i < size; ++i)
+  {
+    rotated(i, i) = 1.0;
+  }
+
+  for (int sweep = 0; sweep < 100; ++sweep)
+  {
+    double off_diagonal = 0.0;
+    for (int p = 0; p < size; ++p)
+    {
+      for (int q = p + 1; q < size; ++q)
+      {
+        off_diagonal += mat(p, q) * mat(p, q);
+      }
+    }
+    if (off_diagonal <= 1.0e-30 * mat.FNorm2())
+    {
+      break;
+    }
+
+    for (int p = 0; p < size; ++p)
+    {
+      for (int q = p + 1; q < size; ++q)
+      {
+        if (mat(p, q) == 0.0)
+        {
+          continue;
+        }
+
+        // Rotation zeroing mat(p, q).
+        const double theta = (mat(q, q) - mat(p, p)) / (2.0 * mat(p, q));
+        const double t = (theta >= 0.0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+        const double c = 1.0 / sqrt(t * t + 1.0);
+        const double s = t * c;
+
+        for (int k = 0; k < size; ++k)
+        {
+          const double m_kp = mat(k, p), m_kq = mat(k, q);
+          mat(k, p) = c * m_kp - s * m_kq;
+          mat(k, q) = s * m_kp + c * m_kq;
+        }
+        for (int k = 0; k < size; ++k)
+        {
+          const double m_pk = mat(p, k), m_qk = mat(q, k);
+          mat(p, k) = c * m_pk - s * m_qk;
+          mat(q, k) = s * m_pk + c * m_qk;
+        }
+        for (int k = 0; k < size; ++k)
+        {
+          const double r_kp = rotated(k, p), r_kq = rotated(k, q);
+          rotated(k, p) = c * r_kp - s * r_kq;
+          rotated(k, q) = s * r_kp + c * r_kq;
+        }
+      }
+    }
+  }
+
+  // Selection sort of the eigenvalues, which are few.
+  std::vector<int> order(size);
+  for (int i = 0; i < size; ++i)
+  {
+    order[i] = i;
+  }
+  for (int i = 0; i < size; ++i)
+  {
+    int largest = i;
+    for (int j = i + 1; j < size; ++j)
+    {
+      if (mat(order[j], order[j]) > mat(order[largest], order[largest]))
+      {
+        largest = j;
+      }
+    }
+    std::swap(order[i], order[largest]);
+  }
+
+  eigenvalues.SetSize(size);
+  vectors.SetSize(size);
+  for (int i = 0; i < size; ++i)
+  {
+    eigenvalues(i) = mat(order[i], order[i]);
+    for (int k = 0; k < size; ++k)
+    {
+      vectors(k, i) = rotated(k, order[i]);
+    }
+  }
+}
+
 } // namespace hephaestus
\ No newline at end of file
@@ -22,6 +22,12 @@ void InheritBdrAttributes(const mfem::ParMesh * parent_mesh, mfem::ParSubMesh *
 // Takes in an array of attributes and turns into a marker array.
 void AttrToMarker(const mfem::Array<int> attr_list, mfem::Array<int> & marker_list, int max_attr);
 
+// Computes the eigenvalues, in decreasing order, and eigenvectors of a small symmetric matrix by
+// cyclic Jacobi rotations. Unlike the dense eigensolvers of MFEM, this does not need LAPACK.
+void SymmetricEigensystem(mfem::DenseMatrix mat,
+                          mfem::Vector & eigenvalues,
+                          mfem::DenseMatrix & vectors);
+
 // Uses the HelmholtzProjector auxsolver to return a divergence-free GridFunction. This version of
 // the function assumes all natural boundary conditions for the HelmholtzProjector equal zero.
 void CleanDivergence(mfem::ParGridFunction & Vec_GF, hephaestus::InputParameters solve_pars);
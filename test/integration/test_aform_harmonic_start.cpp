@@ -0,0 +1,174 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+class TestAFormHarmonicStart
+{
+protected:
+  static double Frequency() { return 1.0 / 60.0; }
+
+  static double PotentialAmplitude(const mfem::Vector & x, double t) { return 2.0; }
+  static double PotentialHigh(const mfem::Vector & x, double t)
+  {
+    return 2.0 * cos(2.0 * M_PI * Frequency() * t);
+  }
+  static double PotentialGround(const mfem::Vector & x, double t) { return 0.0; }
+  static void ZeroBc(const mfem::Vector & x, mfem::Vector & A)
+  {
+    A.SetSize(3);
+    A = 0.0;
+  }
+
+  // Coefficients, BCs and sources shared by the frequency and time domain problems, driven by
+  // the given terminal potential.
+  static void SetUpProblem(hephaestus::ProblemBuilder & problem_builder,
+                           std::shared_ptr<mfem::ParMesh> pmesh,
+                           double (*potential)(const mfem::Vector &, double),
+                           bool complex)
+  {
+    double sigma = 2.0 * M_PI * 10;
+
+    hephaestus::Subdomain wire("wire", 1);
+    wire._scalar_coefficients.Register("electrical_conductivity",
+                                       std::make_shared<mfem::ConstantCoefficient>(sigma));
+    hephaestus::Subdomain air("air", 2);
+    air._scalar_coefficients.Register("electrical_conductivity",
+                                      std::make_shared<mfem::ConstantCoefficient>(1.0e-6 * sigma));
+
+    hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({wire, air}));
+    coefficients._scalars.Register("frequency",
+                                   std::make_shared<mfem::ConstantCoefficient>(Frequency()));
+    coefficients._scalars.Register("dielectric_permittivity",
+                                   std::make_shared<mfem::ConstantCoefficient>(0.0));
+    coefficients._scalars.Register("magnetic_permeability",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+    hephaestus::BCMap bc_map;
+    auto zero_bc = std::make_shared<mfem::VectorFunctionCoefficient>(3, ZeroBc);
+    coefficients._vectors.Register("zero_bc", zero_bc);
+    if (complex)
+    {
+      bc_map.Register("tangential_A",
+                      std::make_shared<hephaestus::VectorDirichletBC>(
+                          std::string("magnetic_vector_potential"),
+                          mfem::Array<int>({1, 2, 3}),
+                          zero_bc.get(),
+                          zero_bc.get()));
+    }
+    else
+    {
+      bc_map.Register("tangential_dAdt",
+                      std::make_shared<hephaestus::VectorDirichletBC>(
+                          std::string("dmagnetic_vector_potential_dt"),
+                          mfem::Array<int>({1, 2, 3}),
+                          zero_bc.get()));
+    }
+
+    auto potential_src = std::make_shared<mfem::FunctionCoefficient>(potential);
+    coefficients._scalars.Register("source_potential", potential_src);
+    bc_map.Register(
+        "high_potential",
+        std::make_shared<hephaestus::ScalarDirichletBC>(
+            std::string("electric_potential"), mfem::Array<int>({1}), potential_src.get()));
+
+    auto potential_ground = std::make_shared<mfem::FunctionCoefficient>(PotentialGround);
+    coefficients._scalars.Register("ground_potential", potential_ground);
+    bc_map.Register(
+        "ground_potential",
+        std::make_shared<hephaestus::ScalarDirichletBC>(
+            std::string("electric_potential"), mfem::Array<int>({2}), potential_ground.get()));
+
+    hephaestus::Sources sources;
+    hephaestus::InputParameters current_solver_options;
+    current_solver_options.SetParam("Tolerance", float(1.0e-12));
+    current_solver_options.SetParam("MaxIter", (unsigned int)1000);
+    sources.Register("source",
+                     std::make_shared<hephaestus::ScalarPotentialSource>("source",
+                                                                         "electric_potential",
+                                                                         "HCurl",
+                                                                         "H1",
+                                                                         "electrical_conductivity",
+                                                                         -1,
+                                                                         current_solver_options));
+
+    hephaestus::InputParameters solver_options;
+    solver_options.SetParam("Tolerance", float(1.0e-12));
+    solver_options.SetParam("MaxIter", (unsigned int)1000);
+
+    problem_builder.SetMesh(pmesh);
+    problem_builder.AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+    problem_builder.AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+    problem_builder.SetBoundaryConditions(bc_map);
+    problem_builder.SetCoefficients(coefficients);
+    problem_builder.SetSources(sources);
+    problem_builder.SetSolverOptions(solver_options);
+  }
+};
+
+TEST_CASE_METHOD(TestAFormHarmonicStart, "TestAFormHarmonicStart", "[CheckRun]")
+{
+  mfem::Mesh mesh((std::string(DATA_DIR) + std::string("./cylinder-hex-q2.gen")).c_str(), 1, 1);
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+  auto harmonic_builder =
+      std::make_unique<hephaestus::ComplexAFormulation>("magnetic_reluctivity",
+                                                        "electrical_conductivity",
+                                                        "dielectric_permittivity",
+                                                        "frequency",
+                                                        "magnetic_vector_potential",
+                                                        "magnetic_vector_potential_real",
+                                                        "magnetic_vector_potential_imag");
+  SetUpProblem(*harmonic_builder, pmesh, PotentialAmplitude, true);
+  harmonic_builder->AddGridFunction("magnetic_vector_potential_real", "HCurl");
+  harmonic_builder->AddGridFunction("magnetic_vector_potential_imag", "HCurl");
+  harmonic_builder->FinalizeProblem();
+  auto harmonic_problem = harmonic_builder->ReturnProblem();
+
+  auto transient_builder = std::make_unique<hephaestus::AFormulation>("magnetic_reluctivity",
+                                                                      "magnetic_permeability",
+                                                                      "electrical_conductivity",
+                                                                      "magnetic_vector_potential");
+  SetUpProblem(*transient_builder, pmesh, PotentialHigh, false);
+  transient_builder->AddGridFunction("magnetic_vector_potential", "HCurl");
+  transient_builder->FinalizeProblem();
+  auto problem = transient_builder->ReturnProblem();
+
+  // Start a third of the way through the period.
+  const float start_time = 20.0;
+  hephaestus::InputParameters exec_params;
+  exec_params.SetParam("TimeStep", float(0.5));
+  exec_params.SetParam("StartTime", start_time);
+  exec_params.SetParam("EndTime", float(start_time + 1.0));
+  exec_params.SetParam("Problem", static_cast<hephaestus::TimeDomainProblem *>(problem.get()));
+  exec_params.SetParam(
+      "HarmonicStartProblem",
+      static_cast<hephaestus::SteadyStateProblem *>(harmonic_problem.get()));
+  exec_params.SetParam("HarmonicStartVariableNames",
+                       std::vector<std::string>({"magnetic_vector_potential"}));
+  exec_params.SetParam("HarmonicStartRealNames",
+                       std::vector<std::string>({"magnetic_vector_potential_real"}));
+  exec_params.SetParam("HarmonicStartImagNames",
+                       std::vector<std::string>({"magnetic_vector_potential_imag"}));
+
+  auto executioner = std::make_unique<hephaestus::TransientExecutioner>(exec_params);
+  executioner->ApplyHarmonicStart();
+
+  // The initial state is the harmonic solution at the phase of the start time.
+  const double omega = 2.0 * M_PI * Frequency();
+  const double phase = omega * start_time;
+  auto * a_real = harmonic_problem->_gridfunctions.Get("magnetic_vector_potential_real");
+  auto * a_imag = harmonic_problem->_gridfunctions.Get("magnetic_vector_potential_imag");
+  auto * a = problem->_gridfunctions.Get("magnetic_vector_potential");
+
+  mfem::Vector a_expected(*a_real);
+  a_expected *= cos(phase);
+  a_expected.Add(-sin(phase), *a_imag);
+
+  const double a_norm = a_expected.Norml2();
+  a_expected -= *a;
+  REQUIRE(a_norm > 0.0);
+  REQUIRE(a_expected.Norml2() < 1.0e-8 * a_norm);
+
+  executioner->Execute();
+}
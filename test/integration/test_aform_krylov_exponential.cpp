@@ -0,0 +1,112 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+class TestAFormKrylovExponential
+{
+protected:
+  // Time-separable source with a quarter period over the run.
+  static void SourceField(const mfem::Vector & x, double t, mfem::Vector & f)
+  {
+    f(0) = 0.0;
+    f(1) = 0.0;
+    f(2) = sin(5.0 * M_PI * t);
+  }
+
+  static void AdotBC(const mfem::Vector & x, mfem::Vector & A) { A = 0.0; }
+
+  // Runs to t = 0.1 with the given time integrator and time step, and returns the true DOFs of
+  // the magnetic vector potential.
+  static void Run(const std::string & time_integrator, float dt, mfem::Vector & a_true)
+  {
+    hephaestus::Subdomain wire("wire", 1);
+    wire._scalar_coefficients.Register("electrical_conductivity",
+                                       std::make_shared<mfem::ConstantCoefficient>(1.0));
+    hephaestus::Subdomain air("air", 2);
+    air._scalar_coefficients.Register("electrical_conductivity",
+                                      std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+    hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({wire, air}));
+    coefficients._scalars.Register("magnetic_permeability",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+    hephaestus::BCMap bc_map;
+    auto adot_vec_coef = std::make_shared<mfem::VectorFunctionCoefficient>(3, AdotBC);
+    coefficients._vectors.Register("surface_tangential_dAdt", adot_vec_coef);
+    bc_map.Register("tangential_dAdt",
+                    std::make_shared<hephaestus::VectorDirichletBC>(
+                        std::string("dmagnetic_vector_potential_dt"),
+                        mfem::Array<int>({1, 2, 3}),
+                        adot_vec_coef.get()));
+
+    hephaestus::Sources sources;
+    auto j_src_coef = std::make_shared<mfem::VectorFunctionCoefficient>(3, SourceField);
+    coefficients._vectors.Register("source", j_src_coef);
+    hephaestus::InputParameters current_solver_options;
+    current_solver_options.SetParam("Tolerance", float(1.0e-12));
+    current_solver_options.SetParam("MaxIter", (unsigned int)200);
+    sources.Register("source",
+                     std::make_shared<hephaestus::DivFreeSource>("source",
+                                                                 "source",
+                                                                 "_HCurlFESpace",
+                                                                 "H1",
+                                                                 "_source_potential",
+                                                                 current_solver_options,
+                                                                 false));
+
+    hephaestus::InputParameters solver_options;
+    solver_options.SetParam("Tolerance", float(1.0e-14));
+    solver_options.SetParam("MaxIter", (unsigned int)1000);
+    solver_options.SetParam("TimeIntegrator", time_integrator);
+    solver_options.SetParam("KrylovDimension", 30);
+
+    mfem::Mesh mesh((std::string(DATA_DIR) + std::string("./beam-tet.mesh")).c_str(), 1, 1);
+    auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+    auto problem_builder = std::make_unique<hephaestus::AFormulation>("magnetic_reluctivity",
+                                                                      "magnetic_permeability",
+                                                                      "electrical_conductivity",
+                                                                      "magnetic_vector_potential");
+    problem_builder->SetMesh(pmesh);
+    problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P2"));
+    problem_builder->SetBoundaryConditions(bc_map);
+    problem_builder->SetCoefficients(coefficients);
+    problem_builder->SetSources(sources);
+    problem_builder->SetSolverOptions(solver_options);
+    problem_builder->FinalizeProblem();
+
+    auto problem = problem_builder->ReturnProblem();
+
+    hephaestus::InputParameters exec_params;
+    exec_params.SetParam("TimeStep", dt);
+    exec_params.SetParam("StartTime", float(0.00));
+    exec_params.SetParam("EndTime", float(0.1));
+    exec_params.SetParam("Problem", static_cast<hephaestus::TimeDomainProblem *>(problem.get()));
+
+    auto executioner = std::make_unique<hephaestus::TransientExecutioner>(exec_params);
+    executioner->Execute();
+
+    auto * a = problem->_gridfunctions.Get("magnetic_vector_potential");
+    a_true.SetSize(a->ParFESpace()->GetTrueVSize());
+    a->ParallelProject(a_true);
+  }
+};
+
+TEST_CASE_METHOD(TestAFormKrylovExponential, "TestAFormKrylovExponential", "[CheckRun]")
+{
+  // The exponential integrator matches a backward Euler run with a hundred times as many steps.
+  mfem::Vector a_backward_euler, a_exponential;
+  Run("BackwardEuler", float(0.00025), a_backward_euler);
+  Run("KrylovExponential", float(0.025), a_exponential);
+
+  mfem::Vector difference(a_exponential);
+  difference -= a_backward_euler;
+
+  const double norm = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, a_backward_euler, a_backward_euler));
+  const double error = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, difference, difference));
+  hephaestus::logger.info("Relative difference to backward Euler: {}", error / norm);
+
+  REQUIRE(norm > 0.0);
+  REQUIRE(error < 1.0e-2 * norm);
+}
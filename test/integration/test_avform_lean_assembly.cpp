@@ -0,0 +1,110 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+class TestAVFormLeanAssembly
+{
+protected:
+  static double PotentialHigh(const mfem::Vector & x, double t) { return 2.0 * cos(t); }
+
+  static void AdotBc(const mfem::Vector & x, double t, mfem::Vector & dAdt) { dAdt = 0.0; }
+
+  // Runs two steps of a conducting cube driven by a potential difference between opposite faces,
+  // and returns the true DOFs of the magnetic vector potential and the electric potential.
+  static void Run(bool lean_assembly, mfem::Vector & a_true, mfem::Vector & v_true)
+  {
+    hephaestus::Coefficients coefficients;
+    coefficients._scalars.Register("electrical_conductivity",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+    coefficients._scalars.Register("magnetic_permeability",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+    hephaestus::BCMap bc_map;
+    auto adot_vec_coef = std::make_shared<mfem::VectorFunctionCoefficient>(3, AdotBc);
+    coefficients._vectors.Register("surface_tangential_dAdt", adot_vec_coef);
+    bc_map.Register("tangential_dAdt",
+                    std::make_shared<hephaestus::VectorDirichletBC>(
+                        std::string("dmagnetic_vector_potential_dt"),
+                        mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                        adot_vec_coef.get()));
+
+    auto high_potential = std::make_shared<mfem::FunctionCoefficient>(PotentialHigh);
+    coefficients._scalars.Register("high_potential_func", high_potential);
+    bc_map.Register("high_potential",
+                    std::make_shared<hephaestus::ScalarDirichletBC>(
+                        std::string("electric_potential"),
+                        mfem::Array<int>({1}),
+                        high_potential.get()));
+
+    auto ground_potential = std::make_shared<mfem::ConstantCoefficient>(0.0);
+    coefficients._scalars.Register("ground_potential_func", ground_potential);
+    bc_map.Register("ground_potential",
+                    std::make_shared<hephaestus::ScalarDirichletBC>(
+                        std::string("electric_potential"),
+                        mfem::Array<int>({6}),
+                        ground_potential.get()));
+
+    hephaestus::InputParameters solver_options;
+    solver_options.SetParam("Tolerance", float(1.0e-12));
+    solver_options.SetParam("MaxIter", (unsigned int)1000);
+    solver_options.SetParam("LeanAssembly", lean_assembly);
+
+    mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+    auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+    auto problem_builder = std::make_unique<hephaestus::AVFormulation>("magnetic_reluctivity",
+                                                                       "magnetic_permeability",
+                                                                       "electrical_conductivity",
+                                                                       "magnetic_vector_potential",
+                                                                       "electric_potential");
+    problem_builder->SetMesh(pmesh);
+    problem_builder->SetBoundaryConditions(bc_map);
+    problem_builder->SetCoefficients(coefficients);
+    problem_builder->SetSolverOptions(solver_options);
+    problem_builder->FinalizeProblem();
+
+    auto problem = problem_builder->ReturnProblem();
+
+    hephaestus::InputParameters exec_params;
+    exec_params.SetParam("TimeStep", float(0.5));
+    exec_params.SetParam("StartTime", float(0.00));
+    exec_params.SetParam("EndTime", float(1.0));
+    exec_params.SetParam("Problem", static_cast<hephaestus::TimeDomainProblem *>(problem.get()));
+
+    auto executioner = std::make_unique<hephaestus::TransientExecutioner>(exec_params);
+    executioner->Execute();
+
+    auto * a = problem->_gridfunctions.Get("magnetic_vector_potential");
+    a_true.SetSize(a->ParFESpace()->GetTrueVSize());
+    a->ParallelProject(a_true);
+
+    auto * v = problem->_gridfunctions.Get("electric_potential");
+    v_true.SetSize(v->ParFESpace()->GetTrueVSize());
+    v->ParallelProject(v_true);
+  }
+
+  static double RelativeDifference(const mfem::Vector & reference, const mfem::Vector & other)
+  {
+    mfem::Vector difference(other);
+    difference -= reference;
+
+    const double norm = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, reference, reference));
+    REQUIRE(norm > 0.0);
+    return sqrt(mfem::InnerProduct(MPI_COMM_WORLD, difference, difference)) / norm;
+  }
+};
+
+TEST_CASE_METHOD(TestAVFormLeanAssembly, "TestAVFormLeanAssembly", "[CheckRun]")
+{
+  // Freeing the form matrices once the monolithic operator has been formed leaves the solution
+  // unchanged, including the mixed blocks coupling the two variables.
+  mfem::Vector a_full, v_full, a_lean, v_lean;
+  Run(false, a_full, v_full);
+  Run(true, a_lean, v_lean);
+
+  const double a_error = RelativeDifference(a_full, a_lean);
+  const double v_error = RelativeDifference(v_full, v_lean);
+  hephaestus::logger.info("Relative differences to the full assembly: {}, {}", a_error, v_error);
+
+  REQUIRE(a_error < 1.0e-8);
+  REQUIRE(v_error < 1.0e-8);
+}
@@ -0,0 +1,96 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+class TestEBFormLeapfrog
+{
+protected:
+  // Lowest resonant mode of the unit cube cavity with perfectly conducting walls, for unit
+  // permittivity and permeability.
+  static double Frequency() { return M_PI * sqrt(2.0); }
+
+  static void EMode(const mfem::Vector & x, double t, mfem::Vector & E)
+  {
+    E(0) = 0.0;
+    E(1) = sin(M_PI * x(0)) * sin(M_PI * x(2)) * cos(Frequency() * t);
+    E(2) = 0.0;
+  }
+
+  static void EInitial(const mfem::Vector & x, mfem::Vector & E) { EMode(x, 0.0, E); }
+
+  static void EBc(const mfem::Vector & x, mfem::Vector & E) { E = 0.0; }
+};
+
+TEST_CASE_METHOD(TestEBFormLeapfrog, "TestEBFormLeapfrog", "[CheckRun]")
+{
+  hephaestus::Coefficients coefficients;
+  coefficients._scalars.Register("magnetic_permeability",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0));
+  coefficients._scalars.Register("electrical_conductivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0e-4));
+  coefficients._scalars.Register("dielectric_permittivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+  hephaestus::BCMap bc_map;
+  auto e_bc_coef = std::make_shared<mfem::VectorFunctionCoefficient>(3, EBc);
+  coefficients._vectors.Register("surface_tangential_E", e_bc_coef);
+  bc_map.Register("tangential_E",
+                  std::make_shared<hephaestus::VectorDirichletBC>(
+                      std::string("electric_field"),
+                      mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                      e_bc_coef.get()));
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Tolerance", float(1.0e-9));
+  solver_options.SetParam("MaxIter", (unsigned int)1000);
+  solver_options.SetParam("TimeIntegrator", std::string("Leapfrog"));
+  solver_options.SetParam("ChebyshevIterations", 20);
+
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 4, 4, mfem::Element::HEXAHEDRON);
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+  auto problem_builder = std::make_unique<hephaestus::EBDualFormulation>("magnetic_reluctivity",
+                                                                         "magnetic_permeability",
+                                                                         "electrical_conductivity",
+                                                                         "electric_field",
+                                                                         "magnetic_flux_density");
+  problem_builder->SetMesh(pmesh);
+  problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P2"));
+  problem_builder->AddFESpace(std::string("HDiv"), std::string("RT_3D_P1"));
+  problem_builder->AddGridFunction(std::string("electric_field"), std::string("HCurl"));
+  problem_builder->AddGridFunction(std::string("magnetic_flux_density"), std::string("HDiv"));
+  problem_builder->SetBoundaryConditions(bc_map);
+  problem_builder->SetCoefficients(coefficients);
+  problem_builder->SetSolverOptions(solver_options);
+  problem_builder->FinalizeProblem();
+
+  auto problem = problem_builder->ReturnProblem();
+
+  // Start from the resonant mode, with zero magnetic flux density.
+  auto * e_field = problem->_gridfunctions.Get("electric_field");
+  mfem::VectorFunctionCoefficient e_initial(3, EInitial);
+  e_field->ProjectCoefficient(e_initial);
+
+  // Run for half a period of the mode.
+  hephaestus::InputParameters exec_params;
+  exec_params.SetParam("TimeStep", float(0.01));
+  exec_params.SetParam("StartTime", float(0.00));
+  exec_params.SetParam("EndTime", float(M_PI / Frequency()));
+  exec_params.SetParam("Problem", static_cast<hephaestus::TimeDomainProblem *>(problem.get()));
+
+  auto executioner = std::make_unique<hephaestus::TransientExecutioner>(exec_params);
+  executioner->Execute();
+
+  mfem::VectorFunctionCoefficient e_exact(3, EMode);
+  e_exact.SetTime(problem->GetOperator()->GetTime());
+
+  mfem::Vector zero(3);
+  zero = 0.0;
+  mfem::VectorConstantCoefficient zero_coef(zero);
+
+  const double error = e_field->ComputeL2Error(e_exact);
+  const double norm = e_field->ComputeL2Error(zero_coef);
+  hephaestus::logger.info("Relative L2 error of the cavity mode: {}", error / norm);
+
+  REQUIRE(norm > 0.0);
+  REQUIRE(error < 5.0e-2 * norm);
+}
@@ -0,0 +1,87 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+class TestHFormStaticCondensation
+{
+protected:
+  static void HdotBc(const mfem::Vector & x, double t, mfem::Vector & H)
+  {
+    H(0) = sin(x(1) * M_PI) * sin(x(2) * M_PI);
+    H(1) = 0;
+    H(2) = 0;
+  }
+
+  // Runs two steps of a conducting cube driven by its boundary values, and returns the true DOFs
+  // of the magnetic field.
+  static void Run(bool static_condensation, mfem::Vector & h_true)
+  {
+    hephaestus::Coefficients coefficients;
+    coefficients._scalars.Register("electrical_conductivity",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+    coefficients._scalars.Register("magnetic_permeability",
+                                   std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+    hephaestus::BCMap bc_map;
+    auto hdot_vec_coef = std::make_shared<mfem::VectorFunctionCoefficient>(3, HdotBc);
+    coefficients._vectors.Register("surface_tangential_dHdt", hdot_vec_coef);
+    bc_map.Register("tangential_dHdt",
+                    std::make_shared<hephaestus::VectorDirichletBC>(
+                        std::string("dmagnetic_field_dt"),
+                        mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                        hdot_vec_coef.get()));
+
+    hephaestus::InputParameters solver_options;
+    solver_options.SetParam("Tolerance", float(1.0e-12));
+    solver_options.SetParam("MaxIter", (unsigned int)1000);
+    solver_options.SetParam("StaticCondensation", static_condensation);
+
+    mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+    auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+    auto problem_builder = std::make_unique<hephaestus::HFormulation>("electrical_resistivity",
+                                                                      "electrical_conductivity",
+                                                                      "magnetic_permeability",
+                                                                      "magnetic_field");
+    problem_builder->SetMesh(pmesh);
+    problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P2"));
+    problem_builder->AddGridFunction(std::string("magnetic_field"), std::string("HCurl"));
+    problem_builder->SetBoundaryConditions(bc_map);
+    problem_builder->SetCoefficients(coefficients);
+    problem_builder->SetSolverOptions(solver_options);
+    problem_builder->FinalizeProblem();
+
+    auto problem = problem_builder->ReturnProblem();
+
+    hephaestus::InputParameters exec_params;
+    exec_params.SetParam("TimeStep", float(0.05));
+    exec_params.SetParam("StartTime", float(0.00));
+    exec_params.SetParam("EndTime", float(0.1));
+    exec_params.SetParam("Problem", static_cast<hephaestus::TimeDomainProblem *>(problem.get()));
+
+    auto executioner = std::make_unique<hephaestus::TransientExecutioner>(exec_params);
+    executioner->Execute();
+
+    auto * h = problem->_gridfunctions.Get("magnetic_field");
+    h_true.SetSize(h->ParFESpace()->GetTrueVSize());
+    h->ParallelProject(h_true);
+  }
+};
+
+TEST_CASE_METHOD(TestHFormStaticCondensation, "TestHFormStaticCondensation", "[CheckRun]")
+{
+  // Condensing the interior DOFs and recovering them after the solve leaves the solution
+  // unchanged.
+  mfem::Vector h_full, h_condensed;
+  Run(false, h_full);
+  Run(true, h_condensed);
+
+  mfem::Vector difference(h_condensed);
+  difference -= h_full;
+
+  const double norm = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, h_full, h_full));
+  const double error = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, difference, difference));
+  hephaestus::logger.info("Relative difference to the full system: {}", error / norm);
+
+  REQUIRE(norm > 0.0);
+  REQUIRE(error < 1.0e-6 * norm);
+}
@@ -0,0 +1,369 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+static void
+WindingDensity(const mfem::Vector & x, mfem::Vector & w)
+{
+  w(0) = -x(1);
+  w(1) = x(0);
+  w(2) = 0.0;
+}
+
+// Solves (α∇×u, ∇×u') + (u, u') = (w, u') with homogeneous Dirichlet BCs, for α piecewise
+// constant on the mesh attributes.
+static void
+SolveCurlCurl(mfem::ParFiniteElementSpace & fespace,
+              mfem::Vector & alpha_values,
+              mfem::VectorCoefficient & source,
+              mfem::ParGridFunction & u)
+{
+  mfem::Array<int> ess_bdr(fespace.GetParMesh()->bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  fespace.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::ParLinearForm lf(&fespace);
+  lf.AddDomainIntegrator(new mfem::VectorFEDomainLFIntegrator(source));
+  lf.Assemble();
+
+  mfem::PWConstCoefficient alpha(alpha_values);
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm blf(&fespace);
+  blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(alpha));
+  blf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(one));
+  blf.Assemble();
+  blf.Finalize();
+
+  u = 0.0;
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  mfem::HypreAMS ams(mat, &fespace);
+  ams.SetPrintLevel(-1);
+  mfem::CGSolver cg(fespace.GetComm());
+  cg.SetRelTol(1e-14);
+  cg.SetMaxIter(500);
+  cg.SetPrintLevel(0);
+  cg.SetPreconditioner(ams);
+  cg.SetOperator(mat);
+  cg.Mult(b, x);
+
+  blf.RecoverFEMSolution(x, lf, u);
+}
+
+TEST_CASE("AdjointSensitivityTest", "[CheckData]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 2, 2, mfem::Element::HEXAHEDRON);
+  for (int e = 0; e < mesh.GetNE(); ++e)
+  {
+    mfem::Vector centre;
+    mesh.GetElementCenter(e, centre);
+    mesh.SetAttribute(e, centre(0) < 0.5 ? 1 : 2);
+  }
+  mesh.SetAttributes();
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::ND_FECollection h_curl_collection(1, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h_curl_fe_space(&pmesh, &h_curl_collection);
+
+  std::vector<hephaestus::Subdomain> subdomains({hephaestus::Subdomain("left", 1),
+                                                 hephaestus::Subdomain("right", 2)});
+  hephaestus::Coefficients coefficients(subdomains);
+  auto winding = std::make_shared<mfem::VectorFunctionCoefficient>(3, WindingDensity);
+  coefficients._vectors.Register("winding", winding);
+
+  auto u = std::make_shared<mfem::ParGridFunction>(&h_curl_fe_space);
+  hephaestus::GridFunctions gridfunctions;
+  gridfunctions.Register("u", u);
+
+  mfem::Vector alpha_values({2.0, 5.0});
+  SolveCurlCurl(h_curl_fe_space, alpha_values, *winding, *u);
+
+  // J = ∫ w⋅u dΩ, for which the adjoint problem has the same right-hand side as the forward
+  // problem, so λ = u.
+  hephaestus::LinearObjective objective("u", "winding");
+  objective.Init(gridfunctions, coefficients);
+  const double j0 = objective.Evaluate();
+
+  mfem::ParGridFunction lambda(*u);
+  std::map<std::string, double> sensitivities;
+  mfem::CurlCurlIntegrator unit_curl_curl;
+  hephaestus::AddSubdomainProducts(unit_curl_curl, lambda, *u, -1.0, subdomains, sensitivities);
+
+  // Compare with central finite differences of the objective.
+  const double step = 1.0e-4;
+  for (int attr = 1; attr <= 2; ++attr)
+  {
+    mfem::Vector perturbed(alpha_values);
+
+    perturbed(attr - 1) = alpha_values(attr - 1) + step;
+    SolveCurlCurl(h_curl_fe_space, perturbed, *winding, *u);
+    const double j_plus = objective.Evaluate();
+
+    perturbed(attr - 1) = alpha_values(attr - 1) - step;
+    SolveCurlCurl(h_curl_fe_space, perturbed, *winding, *u);
+    const double j_minus = objective.Evaluate();
+
+    const double finite_difference = (j_plus - j_minus) / (2.0 * step);
+    const auto & name = subdomains[attr - 1]._name;
+    REQUIRE(sensitivities[name] < 0.0);
+    REQUIRE_THAT(sensitivities[name],
+                 Catch::Matchers::WithinRel(finite_difference, 1.0e-4) ||
+                     Catch::Matchers::WithinAbs(finite_difference, 1.0e-10 * std::abs(j0)));
+  }
+}
+
+static void
+AxialWinding(const mfem::Vector & x, mfem::Vector & w)
+{
+  w(0) = 0.0;
+  w(1) = 0.0;
+  w(2) = x(0);
+}
+
+// Unit cube split into two subdomains at x = 0.5.
+static std::shared_ptr<mfem::ParMesh>
+MakeSplitCube()
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 2, 2, mfem::Element::HEXAHEDRON);
+  for (int e = 0; e < mesh.GetNE(); ++e)
+  {
+    mfem::Vector centre;
+    mesh.GetElementCenter(e, centre);
+    mesh.SetAttribute(e, centre(0) < 0.5 ? 1 : 2);
+  }
+  mesh.SetAttributes();
+  return std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+}
+
+// Registers a uniform source along z, whose amplitude is the constant of source_scale.
+static void
+RegisterScaledSource(hephaestus::Coefficients & coefficients,
+                     std::shared_ptr<mfem::ConstantCoefficient> & source_scale,
+                     hephaestus::Sources & sources)
+{
+  mfem::Vector direction(3);
+  direction = 0.0;
+  direction(2) = 1.0;
+  auto direction_coef = std::make_shared<mfem::VectorConstantCoefficient>(direction);
+  coefficients._vectors.Register("source_direction", direction_coef);
+
+  source_scale = std::make_shared<mfem::ConstantCoefficient>(1.0);
+  coefficients._scalars.Register("source_scale", source_scale);
+  coefficients._vectors.Register(
+      "source",
+      std::make_shared<mfem::ScalarVectorProductCoefficient>(*source_scale, *direction_coef));
+
+  hephaestus::InputParameters source_solver_options;
+  source_solver_options.SetParam("Tolerance", float(1.0e-14));
+  source_solver_options.SetParam("MaxIter", (unsigned int)500);
+  sources.Register("source",
+                   std::make_shared<hephaestus::DivFreeSource>("source",
+                                                               "source",
+                                                               "HCurl",
+                                                               "H1",
+                                                               "_source_potential",
+                                                               source_solver_options,
+                                                               false));
+}
+
+// Returns the central finite difference of the objective for a change of step in value, which
+// is restored afterwards.
+static double
+CentralDifference(hephaestus::SteadyStateProblem & problem,
+                  hephaestus::AdjointObjective & objective,
+                  double & value,
+                  double step)
+{
+  const double original = value;
+
+  value = original + step;
+  problem._coefficients._scalars.MarkModified();
+  problem.GetOperator()->Solve(*(problem._f));
+  const double j_plus = objective.Evaluate();
+
+  value = original - step;
+  problem._coefficients._scalars.MarkModified();
+  problem.GetOperator()->Solve(*(problem._f));
+  const double j_minus = objective.Evaluate();
+
+  value = original;
+  problem._coefficients._scalars.MarkModified();
+  return (j_plus - j_minus) / (2.0 * step);
+}
+
+TEST_CASE("StaticsAdjointFiniteDifferenceTest", "[CheckRun]")
+{
+  auto pmesh = MakeSplitCube();
+
+  auto left_reluctivity = std::make_shared<mfem::ConstantCoefficient>(2.0);
+  auto right_reluctivity = std::make_shared<mfem::ConstantCoefficient>(5.0);
+  hephaestus::Subdomain left("left", 1);
+  left._scalar_coefficients.Register("magnetic_reluctivity", left_reluctivity);
+  hephaestus::Subdomain right("right", 2);
+  right._scalar_coefficients.Register("magnetic_reluctivity", right_reluctivity);
+  hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({left, right}));
+
+  hephaestus::Sources sources;
+  std::shared_ptr<mfem::ConstantCoefficient> source_scale;
+  RegisterScaledSource(coefficients, source_scale, sources);
+  auto axial_winding = std::make_shared<mfem::VectorFunctionCoefficient>(3, AxialWinding);
+  coefficients._vectors.Register("winding", axial_winding);
+
+  hephaestus::BCMap bc_map;
+  mfem::Vector zero(3);
+  zero = 0.0;
+  auto zero_coef = std::make_shared<mfem::VectorConstantCoefficient>(zero);
+  coefficients._vectors.Register("zero", zero_coef);
+  bc_map.Register("tangential_A",
+                  std::make_shared<hephaestus::VectorDirichletBC>(
+                      std::string("magnetic_vector_potential"),
+                      mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                      zero_coef.get()));
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Tolerance", float(1.0e-14));
+  solver_options.SetParam("MaxIter", (unsigned int)1000);
+
+  auto problem_builder = std::make_unique<hephaestus::StaticsFormulation>(
+      "magnetic_reluctivity", "magnetic_vector_potential");
+  problem_builder->SetMesh(pmesh);
+  problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+  problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+  problem_builder->AddGridFunction(std::string("magnetic_vector_potential"),
+                                   std::string("HCurl"));
+  problem_builder->SetBoundaryConditions(bc_map);
+  problem_builder->SetCoefficients(coefficients);
+  problem_builder->SetSources(sources);
+  problem_builder->SetSolverOptions(solver_options);
+  problem_builder->FinalizeProblem();
+  auto problem = problem_builder->ReturnProblem();
+
+  // Flux J = ∫ w⋅A dΩ linked by a winding along z, which depends on ν and the source only
+  // through A.
+  hephaestus::LinearObjective objective("magnetic_vector_potential", "winding");
+  problem->GetOperator()->Solve(*(problem->_f));
+  hephaestus::AdjointSensitivities sensitivities;
+  problem->GetOperator()->SolveAdjoint(objective, sensitivities);
+  REQUIRE(sensitivities._objective > 0.0);
+
+  const double step = 1.0e-4;
+  const double left_difference =
+      CentralDifference(*problem, objective, left_reluctivity->constant, step);
+  const double right_difference =
+      CentralDifference(*problem, objective, right_reluctivity->constant, step);
+  const double source_difference =
+      CentralDifference(*problem, objective, source_scale->constant, step);
+
+  auto & reluctivity_sensitivities = sensitivities._coefficients["magnetic_reluctivity"];
+  REQUIRE(reluctivity_sensitivities.size() == 2);
+  REQUIRE_THAT(reluctivity_sensitivities["left"],
+               Catch::Matchers::WithinRel(left_difference, 1.0e-4));
+  REQUIRE_THAT(reluctivity_sensitivities["right"],
+               Catch::Matchers::WithinRel(right_difference, 1.0e-4));
+  REQUIRE_THAT(sensitivities._sources["source"],
+               Catch::Matchers::WithinRel(source_difference, 1.0e-4));
+}
+
+TEST_CASE("ComplexMaxwellAdjointFiniteDifferenceTest", "[CheckRun]")
+{
+  auto pmesh = MakeSplitCube();
+
+  // The reluctivity is derived from the permeability, so each subdomain reluctivity is perturbed
+  // through its permeability.
+  auto left_permeability = std::make_shared<mfem::ConstantCoefficient>(1.0 / 2.0);
+  auto right_permeability = std::make_shared<mfem::ConstantCoefficient>(1.0 / 5.0);
+  hephaestus::Subdomain left("left", 1);
+  left._scalar_coefficients.Register("magnetic_permeability", left_permeability);
+  hephaestus::Subdomain right("right", 2);
+  right._scalar_coefficients.Register("magnetic_permeability", right_permeability);
+  hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({left, right}));
+
+  coefficients._scalars.Register("frequency", std::make_shared<mfem::ConstantCoefficient>(0.5));
+  coefficients._scalars.Register("dielectric_permittivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(0.0));
+  coefficients._scalars.Register("electrical_conductivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+  hephaestus::Sources sources;
+  std::shared_ptr<mfem::ConstantCoefficient> source_scale;
+  RegisterScaledSource(coefficients, source_scale, sources);
+
+  hephaestus::BCMap bc_map;
+  mfem::Vector zero(3);
+  zero = 0.0;
+  auto zero_coef = std::make_shared<mfem::VectorConstantCoefficient>(zero);
+  coefficients._vectors.Register("zero", zero_coef);
+  bc_map.Register("tangential_A",
+                  std::make_shared<hephaestus::VectorDirichletBC>(
+                      std::string("magnetic_vector_potential"),
+                      mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                      zero_coef.get(),
+                      zero_coef.get()));
+
+  auto problem_builder =
+      std::make_unique<hephaestus::ComplexAFormulation>("magnetic_reluctivity",
+                                                        "electrical_conductivity",
+                                                        "dielectric_permittivity",
+                                                        "frequency",
+                                                        "magnetic_vector_potential",
+                                                        "magnetic_vector_potential_real",
+                                                        "magnetic_vector_potential_imag");
+  problem_builder->SetMesh(pmesh);
+  problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+  problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+  problem_builder->AddGridFunction("magnetic_vector_potential_real", "HCurl");
+  problem_builder->AddGridFunction("magnetic_vector_potential_imag", "HCurl");
+  problem_builder->SetBoundaryConditions(bc_map);
+  problem_builder->SetCoefficients(coefficients);
+  problem_builder->SetSources(sources);
+  problem_builder->FinalizeProblem();
+  auto problem = problem_builder->ReturnProblem();
+
+  // Time-averaged eddy current loss J = ½ ∫ σ |A|² dΩ, up to a factor of ω², which depends on
+  // the reluctivity and the source only through A.
+  hephaestus::EnergyObjective objective(
+      {"magnetic_vector_potential_real", "magnetic_vector_potential_imag"},
+      "electrical_conductivity",
+      false);
+  problem->GetOperator()->Solve(*(problem->_f));
+  hephaestus::AdjointSensitivities sensitivities;
+  problem->GetOperator()->SolveAdjoint(objective, sensitivities);
+  REQUIRE(sensitivities._objective > 0.0);
+
+  // Central differences in the reluctivity ν = 1/μ of each subdomain.
+  const double step = 1.0e-4;
+  std::map<std::string, double> reluctivity_differences;
+  std::map<std::string, mfem::ConstantCoefficient *> permeabilities(
+      {{"left", left_permeability.get()}, {"right", right_permeability.get()}});
+  for (const auto & [name, permeability] : permeabilities)
+  {
+    const double reluctivity = 1.0 / permeability->constant;
+    double value = reluctivity + step;
+    permeability->constant = 1.0 / value;
+    problem->GetOperator()->Solve(*(problem->_f));
+    const double j_plus = objective.Evaluate();
+
+    value = reluctivity - step;
+    permeability->constant = 1.0 / value;
+    problem->GetOperator()->Solve(*(problem->_f));
+    const double j_minus = objective.Evaluate();
+
+    permeability->constant = 1.0 / reluctivity;
+    reluctivity_differences[name] = (j_plus - j_minus) / (2.0 * step);
+  }
+  const double source_difference =
+      CentralDifference(*problem, objective, source_scale->constant, step);
+
+  auto & reluctivity_sensitivities = sensitivities._coefficients["magnetic_reluctivity"];
+  REQUIRE(reluctivity_sensitivities.size() == 2);
+  for (const auto & [name, difference] : reluctivity_differences)
+  {
+    REQUIRE_THAT(reluctivity_sensitivities[name],
+                 Catch::Matchers::WithinRel(difference, 1.0e-4));
+  }
+  REQUIRE_THAT(sensitivities._sources["source"],
+               Catch::Matchers::WithinRel(source_difference, 1.0e-4));
+}
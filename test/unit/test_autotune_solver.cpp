@@ -0,0 +1,142 @@
+#include "autotune_solver.hpp"
+#include "linear_tolerance_policy.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+class TestAutotuneSolver
+{
+protected:
+  TestAutotuneSolver()
+    : _mesh(mfem::Mesh::MakeCartesian3D(4, 4, 4, mfem::Element::HEXAHEDRON)),
+      _pmesh(MPI_COMM_WORLD, _mesh),
+      _h1_collection(2, _pmesh.Dimension()),
+      _h1_fe_space(&_pmesh, &_h1_collection),
+      _one(1.0)
+  {
+    mfem::Array<int> ess_bdr(_pmesh.bdr_attributes.Max());
+    ess_bdr = 1;
+    mfem::Array<int> ess_tdof_list;
+    _h1_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+    mfem::ParLinearForm lf(&_h1_fe_space);
+    lf.AddDomainIntegrator(new mfem::DomainLFIntegrator(_one));
+    lf.Assemble();
+
+    mfem::ParBilinearForm blf(&_h1_fe_space);
+    blf.AddDomainIntegrator(new mfem::DiffusionIntegrator(_one));
+    blf.Assemble();
+    blf.Finalize();
+
+    mfem::ParGridFunction u(&_h1_fe_space);
+    u = 0.0;
+    blf.FormLinearSystem(ess_tdof_list, u, lf, _mat, _x, _b);
+  }
+
+  // AMG-preconditioned CG to the given tolerances.
+  std::shared_ptr<mfem::CGSolver> MakeCandidate(double rel_tol, double abs_tol = 0.0)
+  {
+    auto amg = std::make_shared<mfem::HypreBoomerAMG>();
+    amg->SetPrintLevel(0);
+    _preconditioners.push_back(amg);
+
+    auto cg = std::make_shared<mfem::CGSolver>(MPI_COMM_WORLD);
+    cg->SetRelTol(rel_tol);
+    cg->SetAbsTol(abs_tol);
+    cg->SetMaxIter(200);
+    cg->SetPreconditioner(*amg);
+    return cg;
+  }
+
+  double RelativeResidual(const mfem::Vector & x) const
+  {
+    mfem::Vector r(_b.Size());
+    _mat.Mult(x, r);
+    r -= _b;
+    return mfem::ParNormlp(r, 2, MPI_COMM_WORLD) / mfem::ParNormlp(_b, 2, MPI_COMM_WORLD);
+  }
+
+  mfem::Mesh _mesh;
+  mfem::ParMesh _pmesh;
+  mfem::H1_FECollection _h1_collection;
+  mfem::ParFiniteElementSpace _h1_fe_space;
+  mfem::ConstantCoefficient _one;
+
+  mfem::HypreParMatrix _mat;
+  mfem::Vector _x, _b;
+  std::vector<std::shared_ptr<mfem::Solver>> _preconditioners;
+};
+
+TEST_CASE_METHOD(TestAutotuneSolver, "AutotuneSelectionTest", "[CheckSolution]")
+{
+  auto loose = MakeCandidate(1e-2);
+  // Converged to an absolute tolerance, so that restarting from its solution takes no iterations.
+  auto accurate = MakeCandidate(1e-14, 1e-11);
+
+  std::shared_ptr<mfem::Solver> selected_preconditioner;
+  hephaestus::AutotuneSolver autotune(MPI_COMM_WORLD, "", 1e-8);
+  autotune.AddCandidate("loose", loose, _preconditioners[0]);
+  autotune.AddCandidate("accurate", accurate, _preconditioners[1]);
+  autotune.SetPreconditionerHandle(&selected_preconditioner);
+  autotune.SetOperator(_mat);
+
+  _x = 0.0;
+  autotune.iterative_mode = false;
+  autotune.Mult(_b, _x);
+
+  // Only the accurate candidate meets the acceptance tolerance.
+  REQUIRE(autotune.GetSelectedName() == "accurate");
+  REQUIRE(selected_preconditioner == _preconditioners[1]);
+  REQUIRE(RelativeResidual(_x) < 1e-8);
+
+  // Later solves start from the given initial guess, which here is already the solution.
+  const int cold_iterations = accurate->GetNumIterations();
+  autotune.iterative_mode = true;
+  autotune.Mult(_b, _x);
+  REQUIRE(accurate->GetNumIterations() < cold_iterations);
+  REQUIRE(RelativeResidual(_x) < 1e-8);
+}
+
+TEST_CASE_METHOD(TestAutotuneSolver, "AutotuneFallbackTest", "[CheckSolution]")
+{
+  auto loose = MakeCandidate(1e-2);
+  auto tighter = MakeCandidate(1e-4);
+
+  hephaestus::AutotuneSolver autotune(MPI_COMM_WORLD, "", 1e-14);
+  autotune.AddCandidate("loose", loose, _preconditioners[0]);
+  autotune.AddCandidate("tighter", tighter, _preconditioners[1]);
+  autotune.SetOperator(_mat);
+
+  _x = 0.0;
+  autotune.iterative_mode = false;
+  autotune.Mult(_b, _x);
+
+  // No candidate meets the acceptance tolerance, so the smallest residual is used.
+  REQUIRE(autotune.GetSelectedName() == "tighter");
+  REQUIRE(RelativeResidual(_x) < 1e-3);
+}
+
+TEST_CASE_METHOD(TestAutotuneSolver, "AutotuneToleranceTest", "[CheckSolution]")
+{
+  auto first = MakeCandidate(1e-2);
+  auto second = MakeCandidate(1e-2);
+
+  hephaestus::AutotuneSolver autotune(MPI_COMM_WORLD, "", 1e-8);
+  autotune.AddCandidate("first", first, _preconditioners[0]);
+  autotune.AddCandidate("second", second, _preconditioners[1]);
+  autotune.SetOperator(_mat);
+
+  // Before tuning, the tolerance is forwarded to every candidate, so both meet the acceptance
+  // tolerance that neither meets with its own.
+  REQUIRE(hephaestus::LinearTolerancePolicy::SetRelativeTolerance(autotune, 1e-10));
+
+  _x = 0.0;
+  autotune.iterative_mode = false;
+  autotune.Mult(_b, _x);
+  REQUIRE(autotune.IsTuned());
+  REQUIRE(RelativeResidual(_x) < 1e-8);
+
+  // After tuning, it is forwarded to the selected candidate.
+  REQUIRE(hephaestus::LinearTolerancePolicy::SetRelativeTolerance(autotune, 1e-2));
+  _x = 0.0;
+  autotune.Mult(_b, _x);
+  REQUIRE(RelativeResidual(_x) > 1e-8);
+}
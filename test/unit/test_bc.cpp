@@ -14,3 +14,63 @@ TEST_CASE("BoundaryConditionTest", "[CheckData]")
   for (int i = 0; i < bdr_attrs.Size(); ++i)
     REQUIRE(bdr_attrs[i] == ess_bdr[i]);
 }
+
+double
+Ramp(const mfem::Vector & x, double t)
+{
+  return t;
+}
+
+TEST_CASE("BoundaryConditionPlanTest", "[CheckData]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON);
+
+  hephaestus::BCMap bc_map;
+  mfem::ConstantCoefficient zero(0.0);
+  bc_map.Register("dirichlet_1",
+                  std::make_shared<hephaestus::ScalarDirichletBC>(
+                      std::string("potential"), mfem::Array<int>({1}), &zero));
+
+  auto markers = bc_map.GetEssentialBdrMarkers("potential", &mesh);
+  REQUIRE(markers[0] == 1);
+  REQUIRE(markers[1] == 0);
+  REQUIRE_FALSE(bc_map.HasTimeDependentEssentialBCs("potential", &mesh));
+
+  // Registering a BC invalidates the cached plan for the variable.
+  mfem::FunctionCoefficient ramp(Ramp);
+  bc_map.Register("dirichlet_2",
+                  std::make_shared<hephaestus::ScalarDirichletBC>(
+                      std::string("potential"), mfem::Array<int>({2}), &ramp));
+
+  markers = bc_map.GetEssentialBdrMarkers("potential", &mesh);
+  REQUIRE(markers[0] == 1);
+  REQUIRE(markers[1] == 1);
+  REQUIRE(bc_map.HasTimeDependentEssentialBCs("potential", &mesh));
+}
+
+TEST_CASE("IntegratedBoundaryConditionReuseTest", "[CheckData]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON);
+  mfem::H1_FECollection fec(1, mesh.Dimension());
+  mfem::FiniteElementSpace fespace(&mesh, &fec);
+
+  mfem::ConstantCoefficient flux(2.0);
+  hephaestus::BCMap bc_map;
+  bc_map.Register("neumann",
+                  std::make_shared<hephaestus::IntegratedBC>(
+                      std::string("potential"),
+                      mfem::Array<int>({1}),
+                      std::make_unique<mfem::BoundaryLFIntegrator>(flux)));
+
+  // The BC keeps its integrator, so it can be applied to each newly built form.
+  mfem::LinearForm first(&fespace);
+  bc_map.ApplyIntegratedBCs("potential", first, &mesh);
+  first.Assemble();
+
+  mfem::LinearForm second(&fespace);
+  bc_map.ApplyIntegratedBCs("potential", second, &mesh);
+  second.Assemble();
+
+  REQUIRE(first.Sum() > 0.0);
+  REQUIRE(second.Sum() == first.Sum());
+}
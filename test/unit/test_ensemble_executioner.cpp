@@ -0,0 +1,113 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+// Magnetostatic problem in a unit cube with a uniform source, solved for a reluctivity that is
+// changed in place by each variant.
+class ReluctivityVariants : public hephaestus::EnsembleVariants
+{
+public:
+  [[nodiscard]] int NumVariants() const override { return 2; }
+
+  [[nodiscard]] std::vector<std::string> GetResultNames() const override
+  {
+    return {"reluctivity", "potential_norm"};
+  }
+
+  std::unique_ptr<hephaestus::SteadyStateProblem> BuildProblem(MPI_Comm comm) override
+  {
+    hephaestus::Coefficients coefficients;
+    _reluctivity = std::make_shared<mfem::ConstantCoefficient>(1.0);
+    coefficients._scalars.Register("magnetic_reluctivity", _reluctivity);
+
+    mfem::Vector direction(3);
+    direction = 0.0;
+    direction(2) = 1.0;
+    coefficients._vectors.Register("source",
+                                   std::make_shared<mfem::VectorConstantCoefficient>(direction));
+
+    hephaestus::BCMap bc_map;
+    mfem::Vector zero(3);
+    zero = 0.0;
+    auto zero_vec_coef = std::make_shared<mfem::VectorConstantCoefficient>(zero);
+    coefficients._vectors.Register("zero", zero_vec_coef);
+    bc_map.Register("tangential_A",
+                    std::make_shared<hephaestus::VectorDirichletBC>(
+                        std::string("magnetic_vector_potential"),
+                        mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                        zero_vec_coef.get()));
+
+    hephaestus::InputParameters source_solver_options;
+    source_solver_options.SetParam("Tolerance", float(1.0e-12));
+    source_solver_options.SetParam("MaxIter", (unsigned int)200);
+    hephaestus::Sources sources;
+    sources.Register("source",
+                     std::make_shared<hephaestus::DivFreeSource>("source",
+                                                                 "source",
+                                                                 "HCurl",
+                                                                 "H1",
+                                                                 "_source_potential",
+                                                                 source_solver_options,
+                                                                 false));
+
+    hephaestus::InputParameters solver_options;
+    solver_options.SetParam("Tolerance", float(1.0e-12));
+    solver_options.SetParam("MaxIter", (unsigned int)1000);
+
+    mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(3, 3, 3, mfem::Element::HEXAHEDRON);
+    auto pmesh = std::make_shared<mfem::ParMesh>(comm, mesh);
+
+    auto problem_builder = std::make_unique<hephaestus::StaticsFormulation>(
+        "magnetic_reluctivity", "magnetic_vector_potential");
+    problem_builder->SetMesh(pmesh);
+    problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+    problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+    problem_builder->AddGridFunction(std::string("magnetic_vector_potential"),
+                                     std::string("HCurl"));
+    problem_builder->SetBoundaryConditions(bc_map);
+    problem_builder->SetCoefficients(coefficients);
+    problem_builder->SetSources(sources);
+    problem_builder->SetSolverOptions(solver_options);
+    problem_builder->FinalizeProblem();
+
+    return problem_builder->ReturnProblem();
+  }
+
+  void SetVariant(int variant, hephaestus::SteadyStateProblem & problem) override
+  {
+    // Changed in place, as a material sweep would, without notifying the problem.
+    _reluctivity->constant = 1.0 + 3.0 * variant;
+  }
+
+  void GetResults(int variant,
+                  hephaestus::SteadyStateProblem & problem,
+                  std::vector<double> & results) override
+  {
+    auto * a = problem._gridfunctions.Get("magnetic_vector_potential");
+    mfem::Vector a_true(a->ParFESpace()->GetTrueVSize());
+    a->ParallelProject(a_true);
+
+    results[0] = _reluctivity->constant;
+    results[1] = sqrt(mfem::InnerProduct(a->ParFESpace()->GetComm(), a_true, a_true));
+  }
+
+private:
+  std::shared_ptr<mfem::ConstantCoefficient> _reluctivity{nullptr};
+};
+
+TEST_CASE("EnsembleExecutionerTest", "[CheckRun]")
+{
+  ReluctivityVariants variants;
+
+  hephaestus::InputParameters exec_params;
+  exec_params.SetParam("Variants", static_cast<hephaestus::EnsembleVariants *>(&variants));
+  hephaestus::EnsembleExecutioner executioner(exec_params);
+  executioner.Execute();
+
+  // Each variant is solved with its own reluctivity, so the potential scales with its inverse.
+  const auto & results = executioner.GetResults();
+  REQUIRE(results(0, 0) == 1.0);
+  REQUIRE(results(1, 0) == 4.0);
+  REQUIRE(results(0, 1) > 0.0);
+  REQUIRE_THAT(results(1, 1), Catch::Matchers::WithinRel(results(0, 1) / 4.0, 1.0e-6));
+}
@@ -0,0 +1,53 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("EquationSystemDirichletRevisionTest", "[CheckData]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON);
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+  mfem::H1_FECollection fec(1, pmesh->Dimension());
+  auto fespace = std::make_shared<mfem::ParFiniteElementSpace>(pmesh.get(), &fec);
+
+  hephaestus::FESpaces fespaces;
+  fespaces.Register("H1", fespace);
+  hephaestus::GridFunctions gridfunctions;
+  gridfunctions.Register("potential", std::make_shared<mfem::ParGridFunction>(fespace.get()));
+
+  hephaestus::Coefficients coefficients;
+  coefficients._scalars.Register("conductivity", std::make_shared<mfem::ConstantCoefficient>(1.0));
+  auto boundary_value = std::make_shared<mfem::ConstantCoefficient>(1.0);
+  coefficients._scalars.Register("boundary_value", boundary_value);
+
+  hephaestus::BCMap bc_map;
+  bc_map.Register("dirichlet",
+                  std::make_shared<hephaestus::ScalarDirichletBC>(
+                      std::string("potential"),
+                      mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                      boundary_value.get()));
+
+  hephaestus::InputParameters kernel_params;
+  kernel_params.SetParam("CoefficientName", std::string("conductivity"));
+  hephaestus::EquationSystem equation_system;
+  equation_system.AddTrialVariableNameIfMissing("potential");
+  equation_system.AddKernel("potential",
+                            std::make_shared<hephaestus::DiffusionKernel>(kernel_params));
+  equation_system.Init(gridfunctions, fespaces, bc_map, coefficients);
+
+  hephaestus::Sources sources;
+  mfem::Array<int> offsets({0, fespace->GetTrueVSize()});
+  mfem::BlockVector true_x(offsets), true_rhs(offsets);
+
+  true_x = 0.0;
+  equation_system.BuildEquationSystem(bc_map, sources);
+  equation_system.BuildJacobian(true_x, true_rhs);
+  REQUIRE(true_x.Max() == 1.0);
+
+  // A constant Dirichlet value changed in place is reprojected once the change is marked.
+  boundary_value->constant = 2.0;
+  coefficients._scalars.MarkModified();
+
+  true_x = 0.0;
+  equation_system.BuildEquationSystem(bc_map, sources);
+  equation_system.BuildJacobian(true_x, true_rhs);
+  REQUIRE(true_x.Max() == 2.0);
+}
@@ -0,0 +1,136 @@
+#include "hcurl_preconditioners.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+static void
+SourceField(const mfem::Vector & x, mfem::Vector & f)
+{
+  f(0) = sin(M_PI * x(1));
+  f(1) = sin(M_PI * x(2));
+  f(2) = sin(M_PI * x(0));
+}
+
+TEST_CASE("HCurlPMultigridTest", "[CheckConvergence]")
+{
+  const int order = 3;
+
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::TETRAHEDRON);
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::ND_FECollection h_curl_collection(order, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h_curl_fe_space(&pmesh, &h_curl_collection);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  h_curl_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::VectorFunctionCoefficient source(3, SourceField);
+  mfem::ParLinearForm lf(&h_curl_fe_space);
+  lf.AddDomainIntegrator(new mfem::VectorFEDomainLFIntegrator(source));
+  lf.Assemble();
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm blf(&h_curl_fe_space);
+  blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(one));
+  blf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(one));
+  blf.Assemble();
+  blf.Finalize();
+
+  mfem::ParGridFunction u(&h_curl_fe_space);
+  u = 0.0;
+
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Preconditioner", std::string("PMultigrid"));
+
+  auto precond = hephaestus::CreateHCurlPreconditioner(solver_options, &h_curl_fe_space);
+  auto * pmg = dynamic_cast<hephaestus::HCurlPMultigridSolver *>(precond.get());
+  REQUIRE(pmg != nullptr);
+  REQUIRE(pmg->NumLevels() == order);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1e-10);
+  cg.SetMaxIter(200);
+  cg.SetPrintLevel(0);
+  cg.SetPreconditioner(*precond);
+  cg.SetOperator(mat);
+  cg.Mult(b, x);
+
+  REQUIRE(cg.GetConverged());
+  REQUIRE(cg.GetNumIterations() < 50);
+}
+
+static double
+ConductivityField(const mfem::Vector & x)
+{
+  // Conductor in one half of the cube, near-insulator in the other.
+  return (x(0) < 0.5) ? 1.0e6 : 1.0e-6;
+}
+
+TEST_CASE("HypreMaterialAMSTest", "[CheckConvergence]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 4, 4, mfem::Element::HEXAHEDRON);
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::ND_FECollection h_curl_collection(1, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h_curl_fe_space(&pmesh, &h_curl_collection);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  h_curl_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::VectorFunctionCoefficient source(3, SourceField);
+  mfem::ParLinearForm lf(&h_curl_fe_space);
+  lf.AddDomainIntegrator(new mfem::VectorFEDomainLFIntegrator(source));
+  lf.Assemble();
+
+  mfem::ConstantCoefficient alpha(1.0);
+  mfem::FunctionCoefficient beta(ConductivityField);
+  mfem::ParBilinearForm blf(&h_curl_fe_space);
+  blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(alpha));
+  blf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(beta));
+  blf.Assemble();
+  blf.Finalize();
+
+  mfem::ParGridFunction u(&h_curl_fe_space);
+  u = 0.0;
+
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  hephaestus::HCurlMaterialCoefficients materials;
+  materials._alpha = &alpha;
+  materials._beta = &beta;
+  materials._ess_bdr = ess_bdr;
+
+  // MaterialAMS is opt-in; the default remains AMS.
+  hephaestus::InputParameters default_options;
+  auto default_precond =
+      hephaestus::CreateHCurlPreconditioner(default_options, &h_curl_fe_space, materials);
+  REQUIRE(dynamic_cast<hephaestus::HypreMaterialAMS *>(default_precond.get()) == nullptr);
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Preconditioner", std::string("MaterialAMS"));
+
+  auto precond =
+      hephaestus::CreateHCurlPreconditioner(solver_options, &h_curl_fe_space, materials);
+  REQUIRE(dynamic_cast<hephaestus::HypreMaterialAMS *>(precond.get()) != nullptr);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1e-10);
+  cg.SetMaxIter(200);
+  cg.SetPrintLevel(0);
+  cg.SetPreconditioner(*precond);
+  cg.SetOperator(mat);
+  cg.Mult(b, x);
+
+  REQUIRE(cg.GetConverged());
+  REQUIRE(cg.GetNumIterations() < 100);
+}
@@ -1,4 +1,5 @@
 #include "inputs.hpp"
+#include "parameter_schema.hpp"
 #include <catch2/catch_test_macros.hpp>
 
 extern const char * DATA_DIR;
@@ -24,3 +25,52 @@ TEST_CASE("InputParametersTest", "[CheckData]")
   for (int i = 0; i < example_array.Size(); ++i)
     REQUIRE(example_array[i] == stored_array[i]);
 }
+
+TEST_CASE("ParameterSchemaTest", "[CheckData]")
+{
+  struct ExampleParams
+  {
+    double _tolerance{1.0e-6};
+    unsigned int _max_iter{10};
+    std::string _name;
+  };
+
+  const auto schema = hephaestus::ParameterSchema<ExampleParams>()
+                          .Optional("Tolerance", &ExampleParams::_tolerance)
+                          .Optional("MaxIter", &ExampleParams::_max_iter)
+                          .Required("Name", &ExampleParams::_name);
+
+  hephaestus::InputParameters params;
+  params.SetParam("Tolerance", float(1.0e-3));
+  params.SetParam("Name", std::string("ExampleName"));
+
+  auto parsed = schema.Parse(params);
+
+  // Arithmetic parameters are converted to the declared type; unset parameters keep the defaults.
+  REQUIRE(parsed._tolerance == double(float(1.0e-3)));
+  REQUIRE(parsed._max_iter == 10);
+  REQUIRE(parsed._name == "ExampleName");
+
+  // Defaults may also be supplied at parse time.
+  ExampleParams defaults;
+  defaults._max_iter = 50;
+  REQUIRE(schema.Parse(params, defaults)._max_iter == 50);
+}
+
+TEST_CASE("NumericParamTest", "[CheckData]")
+{
+  hephaestus::InputParameters params;
+  params.SetParam("DoubleParam", 1.0e-3);
+  params.SetParam("FloatParam", float(1.0e-3));
+  params.SetParam("IntegerParam", 2);
+  params.SetParam("StringParam", std::string("NotANumber"));
+
+  // Numeric parameters are converted whatever arithmetic type they were given as.
+  REQUIRE(params.GetOptionalNumericParam<double>("DoubleParam", 1.0) == 1.0e-3);
+  REQUIRE(params.GetOptionalNumericParam<double>("FloatParam", 1.0) == double(float(1.0e-3)));
+  REQUIRE(params.GetOptionalNumericParam<double>("IntegerParam", 1.0) == 2.0);
+
+  // Unset and non-numeric parameters keep the default.
+  REQUIRE(params.GetOptionalNumericParam<double>("UnsetParam", 1.0) == 1.0);
+  REQUIRE(params.GetOptionalNumericParam<double>("StringParam", 1.0) == 1.0);
+}
@@ -0,0 +1,60 @@
+#include "iterative_refinement_solver.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("IterativeRefinementTest", "[CheckSolution]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 4, 4, mfem::Element::HEXAHEDRON);
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::H1_FECollection h1_collection(2, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h1_fe_space(&pmesh, &h1_collection);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  h1_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParLinearForm lf(&h1_fe_space);
+  lf.AddDomainIntegrator(new mfem::DomainLFIntegrator(one));
+  lf.Assemble();
+
+  mfem::ParBilinearForm blf(&h1_fe_space);
+  blf.AddDomainIntegrator(new mfem::DiffusionIntegrator(one));
+  blf.Assemble();
+  blf.Finalize();
+
+  mfem::ParGridFunction u(&h1_fe_space);
+  u = 0.0;
+
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  mfem::HypreBoomerAMG amg(mat);
+  amg.SetPrintLevel(0);
+
+  // The inner solver alone only reduces the residual by three orders of magnitude.
+  auto inner = std::make_shared<mfem::CGSolver>(MPI_COMM_WORLD);
+  inner->SetRelTol(1e-3);
+  inner->SetMaxIter(100);
+  inner->SetPreconditioner(amg);
+
+  hephaestus::IterativeRefinementSolver refinement(MPI_COMM_WORLD, inner);
+  refinement.SetRelTol(1e-10);
+  refinement.SetMaxIter(20);
+  refinement.SetOperator(mat);
+
+  x = 0.0;
+  refinement.iterative_mode = false;
+  refinement.Mult(b, x);
+
+  REQUIRE(refinement.GetConverged());
+  REQUIRE(refinement.GetNumIterations() > 1);
+
+  // The requested tolerance holds for the true residual.
+  mfem::Vector r(b.Size());
+  mat.Mult(x, r);
+  mfem::subtract(b, r, r);
+  REQUIRE(mfem::ParNormlp(r, 2, MPI_COMM_WORLD) <= 1e-10 * mfem::ParNormlp(b, 2, MPI_COMM_WORLD));
+}
@@ -0,0 +1,25 @@
+#include "named_fields_map.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("NamedFieldsMapHandleTest", "[CheckSetup]")
+{
+  hephaestus::NamedFieldsMap<mfem::ConstantCoefficient> coefficients;
+
+  // Handles may be resolved before the field is registered.
+  auto handle = coefficients.GetHandle("conductivity");
+  REQUIRE_FALSE(coefficients.Has(handle));
+
+  coefficients.Register("conductivity", std::make_shared<mfem::ConstantCoefficient>(1.0));
+  REQUIRE(coefficients.Has(handle));
+  REQUIRE(coefficients.Get(handle) == coefficients.Get("conductivity"));
+  REQUIRE(coefficients.GetName(handle) == "conductivity");
+
+  // Re-registering a name updates the slot referred to by its existing handle.
+  coefficients.Register("conductivity", std::make_shared<mfem::ConstantCoefficient>(2.0));
+  REQUIRE(coefficients.GetHandle("conductivity") == handle);
+  REQUIRE(coefficients.GetRef(handle).constant == 2.0);
+
+  coefficients.Deregister("conductivity");
+  REQUIRE_FALSE(coefficients.Has(handle));
+  REQUIRE_FALSE(coefficients.Has("conductivity"));
+}
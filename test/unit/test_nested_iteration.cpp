@@ -0,0 +1,94 @@
+#include "nested_iteration.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+static void
+CurlSourceField(const mfem::Vector & x, mfem::Vector & f)
+{
+  f(0) = sin(M_PI * x(1));
+  f(1) = sin(M_PI * x(2));
+  f(2) = sin(M_PI * x(0));
+}
+
+TEST_CASE("HCurlNestedIterationTest", "[CheckConvergence]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::TETRAHEDRON);
+
+  std::vector<std::shared_ptr<mfem::ParMesh>> meshes;
+  meshes.push_back(std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh));
+  for (int i = 0; i < 2; ++i)
+  {
+    meshes.push_back(std::make_shared<mfem::ParMesh>(*meshes.back()));
+    meshes.back()->UniformRefinement();
+  }
+  mfem::ParMesh & pmesh = *meshes.back();
+
+  mfem::ND_FECollection h_curl_collection(1, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h_curl_fe_space(&pmesh, &h_curl_collection);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  h_curl_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::VectorFunctionCoefficient source(3, CurlSourceField);
+  mfem::ParLinearForm lf(&h_curl_fe_space);
+  lf.AddDomainIntegrator(new mfem::VectorFEDomainLFIntegrator(source));
+  lf.Assemble();
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm blf(&h_curl_fe_space);
+  blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(one));
+  blf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(one));
+  blf.Assemble();
+  blf.Finalize();
+
+  mfem::ParGridFunction u(&h_curl_fe_space);
+  u = 0.0;
+
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  hephaestus::InputParameters solver_options;
+  hephaestus::HCurlNestedIteration nested_iteration(solver_options, meshes, &h_curl_fe_space);
+  REQUIRE(nested_iteration.NumLevels() == 3);
+
+  nested_iteration.SetOperator(mat, ess_bdr);
+
+  // The nested iteration guess removes most of the residual of the zero guess.
+  mfem::Vector guess(x.Size());
+  guess = 0.0;
+  nested_iteration.Mult(b, guess);
+
+  mfem::Vector residual(b.Size());
+  mat.Mult(guess, residual);
+  mfem::subtract(b, residual, residual);
+  REQUIRE(mfem::InnerProduct(MPI_COMM_WORLD, residual, residual) <
+          1.0e-2 * mfem::InnerProduct(MPI_COMM_WORLD, b, b));
+
+  // The fine solve then converges in fewer iterations than from a zero guess.
+  mfem::HypreAMS ams(mat, &h_curl_fe_space);
+  ams.SetPrintLevel(-1);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1e-10);
+  cg.SetMaxIter(200);
+  cg.SetPrintLevel(0);
+  cg.SetPreconditioner(ams);
+  cg.SetOperator(mat);
+
+  x = 0.0;
+  cg.Mult(b, x);
+  REQUIRE(cg.GetConverged());
+  const int zero_guess_iterations = cg.GetNumIterations();
+
+  // Converge to the same final residual norm.
+  cg.SetRelTol(0.0);
+  cg.SetAbsTol(cg.GetFinalNorm());
+  cg.iterative_mode = true;
+  cg.Mult(b, guess);
+  REQUIRE(cg.GetConverged());
+  REQUIRE(cg.GetNumIterations() < zero_guess_iterations);
+}
@@ -0,0 +1,86 @@
+#include "pipelined_krylov_solvers.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+TEST_CASE("PipelinedKrylovTest", "[CheckSolution]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 4, 4, mfem::Element::HEXAHEDRON);
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::H1_FECollection h1_collection(2, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h1_fe_space(&pmesh, &h1_collection);
+
+  mfem::Array<int> ess_bdr(pmesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdof_list;
+  h1_fe_space.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParLinearForm lf(&h1_fe_space);
+  lf.AddDomainIntegrator(new mfem::DomainLFIntegrator(one));
+  lf.Assemble();
+
+  mfem::ParBilinearForm blf(&h1_fe_space);
+  blf.AddDomainIntegrator(new mfem::DiffusionIntegrator(one));
+  blf.Assemble();
+  blf.Finalize();
+
+  mfem::ParGridFunction u(&h1_fe_space);
+  u = 0.0;
+
+  mfem::HypreParMatrix mat;
+  mfem::Vector x, b;
+  blf.FormLinearSystem(ess_tdof_list, u, lf, mat, x, b);
+
+  mfem::HypreBoomerAMG amg(mat);
+  amg.SetPrintLevel(0);
+
+  // Reference solution.
+  mfem::Vector x_ref(x.Size());
+  x_ref = 0.0;
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1e-12);
+  cg.SetMaxIter(500);
+  cg.SetPreconditioner(amg);
+  cg.SetOperator(mat);
+  cg.Mult(b, x_ref);
+  REQUIRE(cg.GetConverged());
+
+  const double tolerance = 1e-8 * mfem::ParNormlp(x_ref, 2, MPI_COMM_WORLD);
+
+  SECTION("PipelinedCG")
+  {
+    hephaestus::PipelinedCGSolver solver(MPI_COMM_WORLD);
+    solver.SetRelTol(1e-12);
+    solver.SetMaxIter(500);
+    solver.SetPreconditioner(amg);
+    solver.SetOperator(mat);
+
+    mfem::Vector x_pcg(x.Size());
+    x_pcg = 0.0;
+    solver.Mult(b, x_pcg);
+
+    REQUIRE(solver.GetConverged());
+    x_pcg -= x_ref;
+    REQUIRE(mfem::ParNormlp(x_pcg, 2, MPI_COMM_WORLD) < tolerance);
+  }
+
+  SECTION("SingleReduceGMRES")
+  {
+    hephaestus::SingleReduceGMRESSolver solver(MPI_COMM_WORLD);
+    solver.SetRelTol(1e-12);
+    solver.SetMaxIter(500);
+    solver.SetKDim(20);
+    solver.SetPreconditioner(amg);
+    solver.SetOperator(mat);
+
+    mfem::Vector x_gmres(x.Size());
+    x_gmres = 0.0;
+    solver.Mult(b, x_gmres);
+
+    REQUIRE(solver.GetConverged());
+    x_gmres -= x_ref;
+    REQUIRE(mfem::ParNormlp(x_gmres, 2, MPI_COMM_WORLD) < tolerance);
+  }
+}
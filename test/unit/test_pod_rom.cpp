@@ -0,0 +1,152 @@
+#include "pod_rom.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+extern const char * DATA_DIR;
+
+static void
+DriveField(const mfem::Vector & x, mfem::Vector & f)
+{
+  f(0) = sin(M_PI * x(1));
+  f(1) = sin(M_PI * x(2));
+  f(2) = sin(M_PI * x(0));
+}
+
+TEST_CASE("RandomisedSVDTest", "[CheckData]")
+{
+  int myid;
+  MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+
+  // Snapshots in the span of three directions.
+  const int height = 50;
+  std::vector<mfem::Vector> directions(4, mfem::Vector(height));
+  for (int k = 0; k < 4; ++k)
+  {
+    for (int i = 0; i < height; ++i)
+    {
+      directions[k](i) = sin((k + 1) * (i + myid * height + 1.0));
+    }
+  }
+
+  hephaestus::InputParameters params;
+  params.SetParam("BasisSize", 10);
+  hephaestus::PODReducedOrderModel rom(params);
+
+  mfem::Vector snapshot(height);
+  for (int j = 0; j < 8; ++j)
+  {
+    snapshot = 0.0;
+    for (int k = 0; k < 3; ++k)
+    {
+      snapshot.Add(cos(j * (k + 1.0)), directions[k]);
+    }
+    rom.AddSnapshot(snapshot);
+  }
+
+  rom.ComputeBasis();
+  REQUIRE(rom.BasisSize() == 3);
+  REQUIRE(rom.TruncationError() < 1.0e-8);
+
+  // The basis is orthonormal.
+  mfem::DenseMatrix gram(rom.BasisSize());
+  mfem::MultAtB(rom.GetBasis(), rom.GetBasis(), gram);
+  MPI_Allreduce(
+      MPI_IN_PLACE, gram.Data(), gram.Height() * gram.Width(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  for (int i = 0; i < gram.Height(); ++i)
+  {
+    gram(i, i) -= 1.0;
+  }
+  REQUIRE(gram.MaxMaxNorm() < 1.0e-10);
+
+  // A snapshot with a new direction enriches the basis by one vector.
+  snapshot.Add(1.0, directions[3]);
+  rom.AddSnapshot(snapshot);
+  REQUIRE(rom.Enrich() == 1);
+  REQUIRE(rom.BasisSize() == 4);
+  REQUIRE(rom.TruncationError() < 1.0e-8);
+  REQUIRE(rom.Enrich() == 0);
+}
+
+TEST_CASE("PODReducedOrderModelTest", "[CheckRun]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::TETRAHEDRON);
+  mfem::ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+  mfem::ND_FECollection h_curl_collection(1, pmesh.Dimension());
+  mfem::ParFiniteElementSpace h_curl_fe_space(&pmesh, &h_curl_collection);
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm mass_blf(&h_curl_fe_space);
+  mass_blf.AddDomainIntegrator(new mfem::VectorFEMassIntegrator(one));
+  mass_blf.Assemble();
+  mass_blf.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> mass(mass_blf.ParallelAssemble());
+
+  mfem::ParBilinearForm stiffness_blf(&h_curl_fe_space);
+  stiffness_blf.AddDomainIntegrator(new mfem::CurlCurlIntegrator(one));
+  stiffness_blf.Assemble();
+  stiffness_blf.Finalize();
+  std::unique_ptr<mfem::HypreParMatrix> stiffness(stiffness_blf.ParallelAssemble());
+
+  mfem::VectorFunctionCoefficient drive(3, DriveField);
+  mfem::ParLinearForm load_lf(&h_curl_fe_space);
+  load_lf.AddDomainIntegrator(new mfem::VectorFEDomainLFIntegrator(drive));
+  load_lf.Assemble();
+  std::unique_ptr<mfem::HypreParVector> load(load_lf.ParallelAssemble());
+
+  // Full order backward Euler run, collecting a snapshot per step.
+  const double dt = 0.05;
+  const int num_steps = 20;
+  mfem::Vector waveform(num_steps);
+  for (int n = 0; n < num_steps; ++n)
+  {
+    waveform(n) = sin(M_PI * (n + 1.0) / num_steps);
+  }
+
+  std::unique_ptr<mfem::HypreParMatrix> step_matrix(mfem::Add(1.0, *mass, dt, *stiffness));
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1e-12);
+  cg.SetMaxIter(1000);
+  cg.SetPrintLevel(0);
+  cg.SetOperator(*step_matrix);
+
+  hephaestus::InputParameters params;
+  params.SetParam("BasisSize", num_steps);
+  hephaestus::PODReducedOrderModel rom(params);
+
+  const int size = h_curl_fe_space.GetTrueVSize();
+  mfem::Vector state(size), rate(size), rhs(size);
+  state = 0.0;
+  for (int n = 0; n < num_steps; ++n)
+  {
+    rhs.Set(waveform(n), *load);
+    stiffness->Mult(-1.0, state, 1.0, rhs);
+    cg.Mult(rhs, rate);
+    REQUIRE(cg.GetConverged());
+    state.Add(dt, rate);
+    rom.AddSnapshot(state);
+  }
+
+  rom.ComputeBasis();
+  rom.Project(*mass, *stiffness, *load);
+
+  // By linearity, the basis captures the response to a scaled waveform exactly.
+  mfem::Vector scaled_waveform(waveform);
+  scaled_waveform *= 2.0;
+  mfem::Vector initial_state(rom.BasisSize());
+  initial_state = 0.0;
+
+  mfem::DenseMatrix states;
+  mfem::Vector indicators;
+  rom.Integrate(dt, scaled_waveform, initial_state, states, indicators);
+  REQUIRE(states.Width() == num_steps + 1);
+  REQUIRE(indicators.Max() < 1.0e-5);
+
+  mfem::Vector final_state, reconstructed;
+  states.GetColumn(num_steps, final_state);
+  rom.Reconstruct(final_state, reconstructed);
+
+  mfem::Vector error(reconstructed);
+  error.Add(-2.0, state);
+  REQUIRE(mfem::InnerProduct(MPI_COMM_WORLD, error, error) <
+          1.0e-12 * 4.0 * mfem::InnerProduct(MPI_COMM_WORLD, state, state));
+}
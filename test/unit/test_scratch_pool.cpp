@@ -0,0 +1,31 @@
+#include "scratch_pool.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("ScratchPoolTest", "[CheckData]")
+{
+  hephaestus::ScratchPool scratch;
+
+  auto & first = scratch.GetVector("vector", 100);
+  REQUIRE(first.Size() == 100);
+  const double * data = first.GetData();
+
+  // Requests that fit reuse the existing storage.
+  auto & smaller = scratch.GetVector("vector", 50);
+  REQUIRE(smaller.Size() == 50);
+  REQUIRE(smaller.GetData() == data);
+  REQUIRE(scratch.GetAllocationCount() == 1);
+  REQUIRE(scratch.GetBytesHeld() == 100 * sizeof(double));
+
+  // Larger requests reallocate.
+  scratch.GetVector("vector", 200);
+  REQUIRE(scratch.GetAllocationCount() == 2);
+  REQUIRE(scratch.GetBytesHeld() == 200 * sizeof(double));
+
+  scratch.GetVector("other", 10);
+  REQUIRE(scratch.GetPeakBytesHeld() == 210 * sizeof(double));
+  REQUIRE(scratch.GetRequestCount() == 4);
+
+  scratch.Clear();
+  REQUIRE(scratch.GetBytesHeld() == 0);
+  REQUIRE(scratch.GetPeakBytesHeld() == 210 * sizeof(double));
+}
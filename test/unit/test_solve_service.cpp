@@ -0,0 +1,244 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <thread>
+
+// Registers a uniform source along z, and homogeneous Dirichlet conditions on the potential.
+static void
+AddUniformSource(hephaestus::Coefficients & coefficients,
+                 hephaestus::Sources & sources,
+                 hephaestus::BCMap & bc_map)
+{
+  mfem::Vector direction(3);
+  direction = 0.0;
+  direction(2) = 1.0;
+  coefficients._vectors.Register("source",
+                                 std::make_shared<mfem::VectorConstantCoefficient>(direction));
+
+  hephaestus::InputParameters source_solver_options;
+  source_solver_options.SetParam("Tolerance", float(1.0e-12));
+  source_solver_options.SetParam("MaxIter", (unsigned int)200);
+  sources.Register("source",
+                   std::make_shared<hephaestus::DivFreeSource>("source",
+                                                               "source",
+                                                               "HCurl",
+                                                               "H1",
+                                                               "_source_potential",
+                                                               source_solver_options,
+                                                               false));
+
+  mfem::Vector zero(3);
+  zero = 0.0;
+  auto zero_coef = std::make_shared<mfem::VectorConstantCoefficient>(zero);
+  coefficients._vectors.Register("zero", zero_coef);
+  bc_map.Register("tangential_A",
+                  std::make_shared<hephaestus::VectorDirichletBC>(
+                      std::string("magnetic_vector_potential"),
+                      mfem::Array<int>({1, 2, 3, 4, 5, 6}),
+                      zero_coef.get(),
+                      zero_coef.get()));
+}
+
+// Returns the value of the result called key in a reply of the service.
+static double
+ResultValue(const std::string & reply, const std::string & key)
+{
+  const std::size_t start = reply.find(key + "=");
+  REQUIRE(start != std::string::npos);
+  return std::stod(reply.substr(start + key.size() + 1));
+}
+
+TEST_CASE("SolveServiceTest", "[CheckData]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON);
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+  mfem::H1_FECollection h1_collection(1, pmesh->Dimension());
+  mfem::ParFiniteElementSpace h1_fe_space(pmesh.get(), &h1_collection);
+
+  hephaestus::SteadyStateProblem problem;
+  problem._pmesh = pmesh;
+  problem._comm = pmesh->GetComm();
+  problem._myid = pmesh->GetMyRank();
+  problem._num_procs = pmesh->GetNRanks();
+
+  auto current = std::make_shared<mfem::ConstantCoefficient>(1.0);
+  problem._coefficients._scalars.Register("current", current);
+
+  auto potential = std::make_shared<mfem::ParGridFunction>(&h1_fe_space);
+  *potential = 1.0;
+  problem._gridfunctions.Register("potential", potential);
+
+  hephaestus::InputParameters service_params;
+  service_params.SetParam("Problem", &problem);
+  service_params.SetParam("SocketPath", std::string("hephaestus_solve_service_test.sock"));
+  hephaestus::SolveServiceExecutioner service(service_params);
+
+  // Source amplitudes leave operators cached from the coefficients valid.
+  const auto revision = problem._coefficients._scalars.GetRevision();
+  REQUIRE(service.HandleRequest("SET_SOURCE current 2.5") == "OK");
+  REQUIRE(current->constant == 2.5);
+  REQUIRE(problem._coefficients._scalars.GetRevision() == revision);
+
+  REQUIRE(service.HandleRequest("SET current 3.0") == "OK");
+  REQUIRE(current->constant == 3.0);
+  REQUIRE(problem._coefficients._scalars.GetRevision() != revision);
+
+  REQUIRE(service.HandleRequest("SET missing 1.0").rfind("ERROR", 0) == 0);
+  REQUIRE(service.HandleRequest("NORM potential").rfind("OK NORM:potential=", 0) == 0);
+
+  // Round trip through the client stub; the socket is served by the root rank only.
+  if (problem._num_procs == 1)
+  {
+    std::thread server(&hephaestus::SolveServiceExecutioner::Execute, &service);
+    {
+      hephaestus::SolveServiceClient client("hephaestus_solve_service_test.sock");
+      REQUIRE(client.Request("SET_SOURCE current 4.0") == "OK");
+      REQUIRE(client.Request("UNKNOWN").rfind("ERROR", 0) == 0);
+      REQUIRE(client.Request("SHUTDOWN") == "OK");
+    }
+    server.join();
+
+    REQUIRE(current->constant == 4.0);
+  }
+}
+
+TEST_CASE("SolveServiceMaterialTest", "[CheckRun]")
+{
+  // Unit cube split into two subdomains, each with its own reluctivity.
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(4, 2, 2, mfem::Element::HEXAHEDRON);
+  for (int e = 0; e < mesh.GetNE(); ++e)
+  {
+    mfem::Vector centre;
+    mesh.GetElementCenter(e, centre);
+    mesh.SetAttribute(e, centre(0) < 0.5 ? 1 : 2);
+  }
+  mesh.SetAttributes();
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+  hephaestus::Subdomain left("left", 1);
+  left._scalar_coefficients.Register("magnetic_reluctivity",
+                                     std::make_shared<mfem::ConstantCoefficient>(1.0));
+  hephaestus::Subdomain right("right", 2);
+  right._scalar_coefficients.Register("magnetic_reluctivity",
+                                      std::make_shared<mfem::ConstantCoefficient>(1.0));
+  hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({left, right}));
+
+  hephaestus::Sources sources;
+  hephaestus::BCMap bc_map;
+  AddUniformSource(coefficients, sources, bc_map);
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Tolerance", float(1.0e-12));
+  solver_options.SetParam("MaxIter", (unsigned int)1000);
+
+  auto problem_builder = std::make_unique<hephaestus::StaticsFormulation>(
+      "magnetic_reluctivity", "magnetic_vector_potential");
+  problem_builder->SetMesh(pmesh);
+  problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+  problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+  problem_builder->AddGridFunction(std::string("magnetic_vector_potential"), std::string("HCurl"));
+  problem_builder->SetBoundaryConditions(bc_map);
+  problem_builder->SetCoefficients(coefficients);
+  problem_builder->SetSources(sources);
+  problem_builder->SetSolverOptions(solver_options);
+  problem_builder->FinalizeProblem();
+  auto problem = problem_builder->ReturnProblem();
+
+  hephaestus::InputParameters service_params;
+  service_params.SetParam("Problem", static_cast<hephaestus::SteadyStateProblem *>(problem.get()));
+  service_params.SetParam("SocketPath", std::string("hephaestus_solve_service_material.sock"));
+  hephaestus::SolveServiceExecutioner service(service_params);
+
+  // Both solves are requested through the service, the second after changing the reluctivity of
+  // each subdomain, which the cached operator must follow. The socket is served by the root rank
+  // only, so requests are executed directly when the problem is distributed.
+  const std::vector<std::string> requests(
+      {"SOLVE NORM magnetic_vector_potential",
+       "SET left.magnetic_reluctivity 4.0 SET right.magnetic_reluctivity 4.0 SOLVE NORM "
+       "magnetic_vector_potential",
+       "SET middle.magnetic_reluctivity 1.0"});
+  std::vector<std::string> replies;
+  if (problem->_num_procs == 1)
+  {
+    std::thread server(&hephaestus::SolveServiceExecutioner::Execute, &service);
+    {
+      hephaestus::SolveServiceClient client("hephaestus_solve_service_material.sock");
+      for (const auto & request : requests)
+      {
+        replies.push_back(client.Request(request));
+      }
+      REQUIRE(client.Request("SHUTDOWN") == "OK");
+    }
+    server.join();
+  }
+  else
+  {
+    for (const auto & request : requests)
+    {
+      replies.push_back(service.HandleRequest(request));
+    }
+  }
+
+  // The potential scales with the inverse of a uniform reluctivity.
+  const double norm = ResultValue(replies[0], "NORM:magnetic_vector_potential");
+  REQUIRE(norm > 0.0);
+  REQUIRE_THAT(ResultValue(replies[1], "NORM:magnetic_vector_potential"),
+               Catch::Matchers::WithinRel(norm / 4.0, 1.0e-6));
+  REQUIRE(replies[2].rfind("ERROR", 0) == 0);
+}
+
+TEST_CASE("SolveServiceFrequencyTest", "[CheckRun]")
+{
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON);
+  auto pmesh = std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, mesh);
+
+  hephaestus::Coefficients coefficients;
+  coefficients._scalars.Register("frequency", std::make_shared<mfem::ConstantCoefficient>(0.5));
+  coefficients._scalars.Register("magnetic_permeability",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0));
+  coefficients._scalars.Register("dielectric_permittivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(0.0));
+  coefficients._scalars.Register("electrical_conductivity",
+                                 std::make_shared<mfem::ConstantCoefficient>(1.0));
+
+  hephaestus::Sources sources;
+  hephaestus::BCMap bc_map;
+  AddUniformSource(coefficients, sources, bc_map);
+
+  auto problem_builder =
+      std::make_unique<hephaestus::ComplexAFormulation>("magnetic_reluctivity",
+                                                        "electrical_conductivity",
+                                                        "dielectric_permittivity",
+                                                        "frequency",
+                                                        "magnetic_vector_potential",
+                                                        "magnetic_vector_potential_real",
+                                                        "magnetic_vector_potential_imag");
+  problem_builder->SetMesh(pmesh);
+  problem_builder->AddFESpace(std::string("HCurl"), std::string("ND_3D_P1"));
+  problem_builder->AddFESpace(std::string("H1"), std::string("H1_3D_P1"));
+  problem_builder->AddGridFunction("magnetic_vector_potential_real", "HCurl");
+  problem_builder->AddGridFunction("magnetic_vector_potential_imag", "HCurl");
+  problem_builder->SetBoundaryConditions(bc_map);
+  problem_builder->SetCoefficients(coefficients);
+  problem_builder->SetSources(sources);
+  problem_builder->FinalizeProblem();
+  auto problem = problem_builder->ReturnProblem();
+
+  hephaestus::InputParameters service_params;
+  service_params.SetParam("Problem", static_cast<hephaestus::SteadyStateProblem *>(problem.get()));
+  hephaestus::SolveServiceExecutioner service(service_params);
+
+  const std::string reply = service.HandleRequest("SOLVE NORM magnetic_vector_potential_imag");
+  const double norm = ResultValue(reply, "NORM:magnetic_vector_potential_imag");
+  REQUIRE(norm > 0.0);
+
+  // The coefficients derived from the frequency follow it, so the solution changes.
+  const std::string changed_reply =
+      service.HandleRequest("SET frequency 2.0 SOLVE NORM magnetic_vector_potential_imag");
+  const double changed_norm = ResultValue(changed_reply, "NORM:magnetic_vector_potential_imag");
+  auto & scalars = problem->_coefficients._scalars;
+  REQUIRE_THAT(scalars.Get<mfem::ConstantCoefficient>("_angular_frequency")->constant,
+               Catch::Matchers::WithinRel(4.0 * M_PI, 1.0e-14));
+  REQUIRE(fabs(changed_norm - norm) > 1.0e-3 * norm);
+}
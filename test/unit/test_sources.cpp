@@ -0,0 +1,100 @@
+#include "hephaestus.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+class TestSources
+{
+protected:
+  TestSources()
+    : _mesh(mfem::Mesh::MakeCartesian3D(2, 2, 2, mfem::Element::HEXAHEDRON)),
+      _pmesh(std::make_shared<mfem::ParMesh>(MPI_COMM_WORLD, _mesh)),
+      _h1_fec(1, 3),
+      _hcurl_fec(1, 3)
+  {
+    _fespaces.Register("H1", std::make_shared<mfem::ParFiniteElementSpace>(_pmesh.get(), &_h1_fec));
+    _fespaces.Register("HCurl",
+                       std::make_shared<mfem::ParFiniteElementSpace>(_pmesh.get(), &_hcurl_fec));
+  }
+
+  // Applies the source to two zeroed linear forms and returns the relative difference between
+  // the results, which should vanish however often the source is applied.
+  double ApplyTwice(hephaestus::Source & source, double & norm)
+  {
+    auto * fespace = _fespaces.Get("HCurl");
+    mfem::ParLinearForm first(fespace), second(fespace);
+    first = 0.0;
+    second = 0.0;
+    source.Apply(&first);
+    source.Apply(&second);
+
+    norm = sqrt(mfem::InnerProduct(MPI_COMM_WORLD, first, first));
+    second -= first;
+    return sqrt(mfem::InnerProduct(MPI_COMM_WORLD, second, second)) / norm;
+  }
+
+  mfem::Mesh _mesh;
+  std::shared_ptr<mfem::ParMesh> _pmesh;
+  mfem::H1_FECollection _h1_fec;
+  mfem::ND_FECollection _hcurl_fec;
+  hephaestus::FESpaces _fespaces;
+  hephaestus::GridFunctions _gridfunctions;
+  hephaestus::BCMap _bc_map;
+  hephaestus::Coefficients _coefficients;
+};
+
+TEST_CASE_METHOD(TestSources, "ScalarPotentialSourceReapplyTest", "[CheckRun]")
+{
+  _coefficients._scalars.Register("electrical_conductivity",
+                                  std::make_shared<mfem::ConstantCoefficient>(1.0));
+  auto ground = std::make_shared<mfem::ConstantCoefficient>(0.0);
+  _coefficients._scalars.Register("ground", ground);
+  auto flux = std::make_shared<mfem::ConstantCoefficient>(1.0);
+  _coefficients._scalars.Register("flux", flux);
+
+  _bc_map.Register("ground",
+                   std::make_shared<hephaestus::ScalarDirichletBC>(
+                       std::string("electric_potential"), mfem::Array<int>({1}), ground.get()));
+  _bc_map.Register("inflow",
+                   std::make_shared<hephaestus::IntegratedBC>(
+                       std::string("electric_potential"),
+                       mfem::Array<int>({6}),
+                       std::make_unique<mfem::BoundaryLFIntegrator>(*flux)));
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Tolerance", float(1.0e-12));
+  solver_options.SetParam("MaxIter", (unsigned int)1000);
+  hephaestus::ScalarPotentialSource source("grad_electric_potential",
+                                           "electric_potential",
+                                           "HCurl",
+                                           "H1",
+                                           "electrical_conductivity",
+                                           -1,
+                                           solver_options);
+  source.Init(_gridfunctions, _fespaces, _bc_map, _coefficients);
+
+  // The integrated BC drives the source, and is applied only once.
+  double norm;
+  const double difference = ApplyTwice(source, norm);
+  REQUIRE(norm > 0.0);
+  REQUIRE(difference < 1.0e-8);
+}
+
+TEST_CASE_METHOD(TestSources, "DivFreeSourceReapplyTest", "[CheckRun]")
+{
+  mfem::Vector direction(3);
+  direction = 0.0;
+  direction(2) = 1.0;
+  _coefficients._vectors.Register("source",
+                                  std::make_shared<mfem::VectorConstantCoefficient>(direction));
+
+  hephaestus::InputParameters solver_options;
+  solver_options.SetParam("Tolerance", float(1.0e-12));
+  solver_options.SetParam("MaxIter", (unsigned int)1000);
+  hephaestus::DivFreeSource source(
+      "source", "div_free_source", "HCurl", "H1", "_source_potential", solver_options);
+  source.Init(_gridfunctions, _fespaces, _bc_map, _coefficients);
+
+  double norm;
+  const double difference = ApplyTwice(source, norm);
+  REQUIRE(norm > 0.0);
+  REQUIRE(difference < 1.0e-8);
+}
@@ -124,4 +124,44 @@ TEST_CASE("CoefficientsTest", "[CheckData]")
   REQUIRE_THAT(pw->Eval(t, ip), Catch::Matchers::WithinAbs(150.0, eps));
   t.Attribute = 2;
   REQUIRE_THAT(pw->Eval(t, ip), Catch::Matchers::WithinAbs(152.0, eps));
-}
\ No newline at end of file
+}
+
+TEST_CASE("CoefficientSupportTest", "[CheckData]")
+{
+  hephaestus::Subdomain wire("wire", 1);
+  wire._scalar_coefficients.Register("electrical_conductivity",
+                                     std::make_shared<mfem::ConstantCoefficient>(5.8e7));
+
+  hephaestus::Subdomain air("air", 2);
+  auto air_conductivity = std::make_shared<mfem::ConstantCoefficient>(0.0);
+  air._scalar_coefficients.Register("electrical_conductivity", air_conductivity);
+
+  hephaestus::Coefficients coefficients(std::vector<hephaestus::Subdomain>({wire, air}));
+
+  mfem::Mesh mesh = mfem::Mesh::MakeCartesian3D(2, 1, 1, mfem::Element::HEXAHEDRON);
+  mesh.SetAttribute(1, 2);
+  mesh.SetAttributes();
+
+  // Zero-valued subdomains lie outside the support of the property.
+  mfem::Array<int> markers;
+  REQUIRE(coefficients.GetSupportMarkers("electrical_conductivity", mesh, markers));
+  REQUIRE(markers.Size() == 2);
+  REQUIRE(markers[0] == 1);
+  REQUIRE(markers[1] == 0);
+
+  // No restriction applies to coefficients without a recorded support.
+  REQUIRE_FALSE(coefficients.GetSupportMarkers("_one", mesh, markers));
+
+  // The support is recomputed once a subdomain value changed in place is marked as modified.
+  air_conductivity->constant = 1.0;
+  coefficients._scalars.MarkModified();
+  REQUIRE_FALSE(coefficients.GetSupportMarkers("electrical_conductivity", mesh, markers));
+
+  // Supports shared with another coefficient follow its changes.
+  coefficients.ShareSupport("loss", "electrical_conductivity");
+  air_conductivity->constant = 0.0;
+  coefficients._scalars.MarkModified();
+  REQUIRE(coefficients.GetSupportMarkers("loss", mesh, markers));
+  REQUIRE(markers[0] == 1);
+  REQUIRE(markers[1] == 0);
+}